@@ -1,5 +1,10 @@
 #include "python/PythonManager.h"
+#include "python/CheatRegistry.h"
 #include "utils/Logger.h"
+#include "utils/PluginStats.h"
+#include "utils/StartupProfiler.h"
+#include "utils/StateStore.h"
+#include "utils/Telemetry.h"
 #include "cRZMessage2COMDirector.h"
 #include "cIGZMessage2Standard.h"
 #include "cIGZFrameWork.h"
@@ -24,9 +29,13 @@ static const uint32_t kGZIID_cISC4App = 0x26ce01c0;
 // SC4 Message IDs
 static const uint32_t kGZMSG_CheatIssued = 0x230e27ac;
 static const uint32_t kGZMSG_CityInited = 0x26d31ec1;
+static const uint32_t kGZMSG_CityShutdown = 0x26c63346;
 static const uint32_t kMsgQueryExecStart = 0x26ad8e01;
 static const uint32_t kMsgQueryExecEnd = 0x26ad8e02;
 
+// Built-in diagnostics cheat ID - "PYST" in ASCII
+static const uint32_t kPystatsCheatID = 0x50595354;
+
 
 class PythonFrameworkDllDirector final : public cRZMessage2COMDirector
 {
@@ -51,6 +60,7 @@ public:
     bool OnStart(cIGZCOM* pCOM) override
     {
         (void)pCOM; // Unused parameter
+        StartupProfiler::Scope profile("OnStart");
         LOG_INFO("OnStart() called");
 
         // Create PythonManager here (deferred initialization)
@@ -58,12 +68,17 @@ public:
         pythonManager = std::make_unique<PythonManager>();
         LOG_INFO("PythonManager created successfully");
 
+        // Boot the interpreter on a background thread so it overlaps with
+        // SC4's own asset loading; PostAppInit() joins and verifies
+        pythonManager->InitializeAsync();
+
         mpFrameWork->AddHook(this);
         return true;
     }
 
     bool PreAppInit() override
     {
+        StartupProfiler::Scope profile("PreAppInit");
         LOG_INFO("PreAppInit() called - deferring Python init to PostAppInit");
         // Defer Python initialization to PostAppInit to ensure all DLLs are loaded
         return true;
@@ -76,33 +91,63 @@ public:
             LOG_ERROR("PostAppInit() called but PythonManager not created");
             return false;
         }
-        
-        // Get and register with the cheat manager
-        if (!SetupCheatManager()) {
-            LOG_WARN("Failed to setup cheat manager integration");
-        }
-        
-        // Initialize Python environment first
-        if (!pythonManager->Initialize()) {
-            LOG_ERROR("Failed to initialize Python environment");
-            return false;
-        }
-        
-        // Then load plugins
-        bool result = pythonManager->LoadPlugins();
-        
-        // Register Python plugin cheats with SC4
-        RegisterPythonCheats();
-        
-        // Register for city messages
-        cIGZMessageServer2Ptr pMsgServ;
-        if (pMsgServ) {
-            pMsgServ->AddNotification(this, kGZMSG_CityInited);
-            LOG_INFO("Registered for city initialization messages");
-        } else {
-            LOG_WARN("Failed to get message server for city notifications");
+
+        bool result;
+        {
+            StartupProfiler::Scope profile("PostAppInit");
+
+            // Get and register with the cheat manager
+            {
+                StartupProfiler::Scope setupProfile("SetupCheatManager");
+                if (!SetupCheatManager()) {
+                    LOG_WARN("Failed to setup cheat manager integration");
+                }
+            }
+
+            // Join the background initialization started in OnStart()
+            {
+                StartupProfiler::Scope waitProfile("WaitForInitialization");
+                if (!pythonManager->WaitForInitialization()) {
+                    LOG_ERROR("Failed to initialize Python environment");
+                    return false;
+                }
+            }
+
+            // Then load plugins
+            {
+                StartupProfiler::Scope loadProfile("LoadPlugins");
+                result = pythonManager->LoadPlugins();
+            }
+
+            // Register Python plugin cheats with SC4
+            {
+                StartupProfiler::Scope cheatsProfile("RegisterPythonCheats");
+                RegisterPythonCheats();
+            }
+
+            // Register for city messages
+            cIGZMessageServer2Ptr pMsgServ;
+            if (pMsgServ) {
+                pMsgServ->AddNotification(this, kGZMSG_CityInited);
+                pMsgServ->AddNotification(this, kGZMSG_CityShutdown);
+                // Simulation activity messages drive stats-cache invalidation;
+                // further sim-tick/budget message IDs belong in this list
+                pMsgServ->AddNotification(this, kMsgQueryExecStart);
+                pMsgServ->AddNotification(this, kMsgQueryExecEnd);
+                LOG_INFO("Registered for city and simulation messages");
+            } else {
+                LOG_WARN("Failed to get message server for city notifications");
+            }
+
+            // External monitoring reads the shared-memory telemetry block;
+            // failure only disables the export
+            Telemetry::Initialize();
         }
-        
+
+        // Startup is over: persist the phase timing report next to the
+        // log and log the slowest stages
+        StartupProfiler::WriteReport();
+
         LOG_INFO("PostAppInit() completed successfully");
         return result;
     }
@@ -110,6 +155,9 @@ public:
     bool PreAppShutdown() override
     {
         LOG_INFO("PreAppShutdown() called");
+        // Defensive close for exit paths that skip the city shutdown
+        // message; a no-op when the store already closed with the city
+        StateStore::Close();
         if (pythonManager) {
             pythonManager->UnloadPlugins();
         }
@@ -120,6 +168,7 @@ public:
     bool PostAppShutdown() override
     {
         LOG_INFO("PostAppShutdown() called");
+        Telemetry::Shutdown();
         if (pythonManager) {
             pythonManager->Shutdown();
         }
@@ -133,8 +182,38 @@ public:
             return false;
         }
 
-        uint32_t messageType = pMessage->GetType();
-        
+        const uint32_t messageType = pMessage->GetType();
+
+        // Interest gate, before any logging, allocation or GIL work: one
+        // hash probe decides whether this message involves Python at all.
+        // The probe set is maintained by PythonManager's subscription
+        // registry on plugin load/unload/reload.
+        const bool frameworkMessage =
+            messageType == kGZMSG_CheatIssued ||
+            messageType == kGZMSG_CityInited ||
+            messageType == kGZMSG_CityShutdown ||
+            messageType == kMsgQueryExecStart ||
+            messageType == kMsgQueryExecEnd;
+        const bool pluginMessage =
+            pythonManager && pythonManager->IsMessageSubscribed(messageType);
+        if (!frameworkMessage && !pluginMessage) {
+            return true;
+        }
+        messagesDispatched++;
+
+        // Safe point: apply side effects posted by deferred (worker thread)
+        // plugin handlers before processing the next message
+        if (pythonManager) {
+            pythonManager->DrainCompletedWork();
+        }
+
+        // Cheats pushed through sc4_native.register_cheat() after startup
+        // (hot reload, late initialization) get their SC4-side registration
+        // here; a relaxed counter check makes the common case free
+        if (cheatManager && CheatRegistry::HasPending()) {
+            FlushPendingCheatRegistrations();
+        }
+
         if (messageType == kGZMSG_CheatIssued) {
             try {
                 LOG_INFO("Cheat message received");
@@ -164,6 +243,7 @@ public:
                     const auto& cheatInfo = cheatIter->second;
                     LOG_INFO("Processing Python cheat ID 0x{:08x}: '{}' from plugin '{}'", 
                             dwCheatID, cheatText, cheatInfo.pluginName);
+                    cheatsDispatched++;
                     ProcessCheat(dwCheatID, pszCheatData);
                 } else {
                     LOG_DEBUG("Ignoring non-Python cheat ID 0x{:08x}: '{}'", dwCheatID, cheatText);
@@ -178,7 +258,60 @@ public:
             LOG_INFO("Processing city initialization message");
             if (pythonManager) {
                 pythonManager->OnCityInit();
+                // Open the city's persistent state store once the wrapper
+                // knows the city name; loads existing entries into memory
+                StateStore::Open(pythonManager->GetCityWrapper()->GetCityName());
+            }
+        }
+        else if (messageType == kGZMSG_CityShutdown) {
+            LOG_INFO("Processing city shutdown message");
+            // Notify plugins and drop the CityWrapper's cached simulator
+            // pointers before they dangle; the getters trust them without
+            // re-validating against the city
+            if (pythonManager) {
+                pythonManager->OnCityShutdown();
             }
+            // Final synchronous flush; bounded write-behind handled the
+            // rest during play
+            StateStore::Close();
+        }
+        else if (messageType == kMsgQueryExecStart || messageType == kMsgQueryExecEnd) {
+            // Simulation activity: cached city state may now be stale.
+            // Invalidation is a flag write plus a generation bump, so doing
+            // it per message is cheap; the next GetCityStats() re-queries.
+            if (pythonManager) {
+                auto city = pythonManager->GetCityWrapper();
+                city->InvalidateStatsCache();
+
+                // Feed the time-series recorder once per exec cycle; a
+                // non-sampling tick is two integer ops
+                if (messageType == kMsgQueryExecEnd) {
+                    city->RecordTick();
+                    // Flip the double-buffered snapshot so off-thread
+                    // readers see this cycle's consistent city state
+                    city->PublishSnapshot();
+                    // Isolated plugin hosts read city state from published
+                    // POD snapshots, refreshed once per exec cycle
+                    pythonManager->PublishCityState();
+                    // Give coroutine handlers their per-frame slice
+                    pythonManager->PumpAsyncTasks();
+
+                    // Refresh the external telemetry block: a seqlocked
+                    // handful of stores per exec cycle
+                    Telemetry::CityFields fields;
+                    fields.date = city->GetCityDate();
+                    fields.funds = city->GetCityMoney();
+                    fields.stats = city->GetCityStats();
+                    Telemetry::Publish(fields, messagesDispatched, cheatsDispatched);
+                }
+            }
+        }
+
+        // Fan the message out to subscribed plugin handlers; the framework
+        // types above reach plugins through their dedicated paths instead
+        if (pluginMessage && !frameworkMessage) {
+            pythonManager->HandleMessage(messageType,
+                                         static_cast<cIGZMessage2Standard*>(pMessage));
         }
 
         return true;
@@ -187,13 +320,57 @@ public:
 private:
     std::unique_ptr<PythonManager> pythonManager;
     cIGZCheatCodeManager* cheatManager;
+
+    // Throughput counters exported through the telemetry region
+    uint64_t messagesDispatched = 0;
+    uint64_t cheatsDispatched = 0;
     
     struct CheatInfo {
         std::string cheatText;
         std::string pluginName;
     };
     std::unordered_map<uint32_t, CheatInfo> registeredCheats; // Maps cheat ID to cheat info
-    
+
+    // Shared ID counter for both registration paths so push-registered and
+    // polled cheats never collide
+    uint32_t nextPythonCheatID = 0x50594348; // "PYCH" in ASCII - Python Cheat base ID
+
+    // Registers cheats pushed through sc4_native.register_cheat() with SC4's
+    // cheat code manager and records them for the DoMessage ID gate
+    void FlushPendingCheatRegistrations()
+    {
+        CheatRegistry::FlushPending([this](const std::string& cheatText,
+                                           const std::string& description) -> uint32_t {
+            (void)description;
+            cRZBaseString cheatName(cheatText.c_str());
+
+            // After a reload the cheat code may already be registered with
+            // SC4; rebind the existing ID instead of allocating a new one
+            uint32_t existingCheatID = 0;
+            if (cheatManager->DoesCheatCodeMatch(cheatName, existingCheatID)) {
+                LOG_DEBUG("Rebinding existing cheat '{}' to ID 0x{:08x}", cheatText, existingCheatID);
+                CheatInfo cheatInfo;
+                cheatInfo.cheatText = cheatText;
+                cheatInfo.pluginName = "(sc4_native.register_cheat)";
+                registeredCheats[existingCheatID] = cheatInfo;
+                return existingCheatID;
+            }
+
+            uint32_t cheatID = nextPythonCheatID++;
+            if (!cheatManager->RegisterCheatCode(cheatID, cheatName)) {
+                LOG_WARN("Failed to register pushed cheat: '{}'", cheatText);
+                return 0;
+            }
+
+            CheatInfo cheatInfo;
+            cheatInfo.cheatText = cheatText;
+            cheatInfo.pluginName = "(sc4_native.register_cheat)";
+            registeredCheats[cheatID] = cheatInfo;
+            LOG_INFO("Registered pushed cheat: '{}' with ID 0x{:08x}", cheatText, cheatID);
+            return cheatID;
+        });
+    }
+
     bool SetupCheatManager()
     {
         cIGZFrameWork* const pFramework = RZGetFrameWork();
@@ -235,13 +412,30 @@ private:
             return;
         }
         
-        // Get list of registered cheats from Python plugins with plugin info
+        // Built-in "pystats" cheat: dumps the per-plugin dispatch timing
+        // report to the log without needing any plugin installed
+        cRZBaseString pystatsName("pystats");
+        uint32_t existingPystatsID = 0;
+        if (!cheatManager->DoesCheatCodeMatch(pystatsName, existingPystatsID)) {
+            if (cheatManager->RegisterCheatCode(kPystatsCheatID, pystatsName)) {
+                CheatInfo pystatsCheat;
+                pystatsCheat.cheatText = "pystats";
+                pystatsCheat.pluginName = "(built-in)";
+                registeredCheats[kPystatsCheatID] = pystatsCheat;
+                LOG_INFO("Registered built-in cheat 'pystats' with ID 0x{:08x}", kPystatsCheatID);
+            }
+        }
+
+        // Cheats pushed through sc4_native.register_cheat() during plugin
+        // load get their SC4-side registration first; the polling pass below
+        // then skips anything already registered. Plugins on the push API
+        // cost nothing here.
+        FlushPendingCheatRegistrations();
+
+        // Legacy polling pass for plugins that still declare cheats through
+        // get_registered_cheats() instead of the push API
         auto pythonCheats = pythonManager->GetRegisteredCheatsWithPlugin();
-        
-        // Use a deterministic cheat ID generation scheme to avoid collisions
-        uint32_t baseCheatID = 0x50594348; // "PYCH" in ASCII - Python Cheat base ID
-        uint32_t cheatCounter = 0;
-        
+
         for (const auto& cheatInfo : pythonCheats) {
             // Normalize cheat text to lowercase for consistent handling
             std::string lowerCheatText = cheatInfo.cheatText;
@@ -255,8 +449,8 @@ private:
                 continue;
             }
             
-            uint32_t cheatID = baseCheatID + cheatCounter++;
-            
+            uint32_t cheatID = nextPythonCheatID++;
+
             if (cheatManager->RegisterCheatCode(cheatID, cheatName)) {
                 LOG_INFO("Registered Python cheat: '{}' from plugin '{}' with ID 0x{:08x}", 
                         lowerCheatText, cheatInfo.pluginName, cheatID);
@@ -287,7 +481,28 @@ private:
         }
 
         LOG_INFO("ProcessCheat called - ID: 0x{:08x}, Text: '{}'", dwCheatID, cheatText);
-        
+
+        // Built-in diagnostics: dump dispatch timing without entering Python
+        if (dwCheatID == kPystatsCheatID) {
+            LOG_INFO("Plugin dispatch statistics:\n{}", PluginStats::FormatReport());
+            Logger::FlushNow();
+            return true;
+        }
+
+        // Native-fast cheats run their prebuilt action against CityWrapper
+        // without entering the interpreter at all
+        if (auto city = pythonManager->GetCityWrapper()) {
+            if (CheatRegistry::DispatchNative(dwCheatID, cheatText, *city)) {
+                return true;
+            }
+        }
+
+        // Push-registered cheats dispatch straight from ID to the cached
+        // bound callable - no plugin iteration, no CheatCommand conversion
+        if (CheatRegistry::Owns(dwCheatID)) {
+            return CheatRegistry::Dispatch(dwCheatID, cheatText);
+        }
+
         // Check if we have this cheat registered and get the plugin name
         auto cheatIter = registeredCheats.find(dwCheatID);
         if (cheatIter != registeredCheats.end()) {
@@ -0,0 +1,205 @@
+// Microbenchmarks for the binding and dispatch hot paths.
+//
+// Build with -DSC4PY_BUILD_BENCHMARKS=ON and run:
+//   sc4py_bench --benchmark_format=json --benchmark_out=sc4py_bench.json
+// so results can be tracked across releases.
+//
+// The benchmarks drive the real PythonManager/CityWrapper code. Synthetic
+// plugins are generated into the PythonScripts/examples directory that
+// GetPluginsDirectory() resolves relative to this executable, so the
+// normal discovery/load path is exercised. No live SC4 city is required:
+// CityWrapper paths run against an invalid city (worst-case null checks)
+// and HandleMessage accepts a null cIGZMessage2Standard.
+
+// pybind11 includes MUST be first - included via PythonManager.h
+#include "../python/PythonManager.h"
+
+#include "../wrappers/CityWrapper.h"
+#include "../utils/Logger.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+
+// gzcom-dll's COM glue expects the hosting module to provide a director;
+// the benchmarks never go through COM, so a null stub satisfies the link
+class cRZCOMDllDirector;
+cRZCOMDllDirector* RZGetCOMDllDirector() { return nullptr; }
+
+namespace
+{
+    // Message type the synthetic plugins subscribe to, and one nobody wants
+    constexpr uint32_t kSubscribedMessage = 0x42000001;
+    constexpr uint32_t kUnsubscribedMessage = 0x42000002;
+
+    PythonManager& Manager()
+    {
+        static PythonManager manager;
+        static bool initialized = manager.Initialize();
+        (void)initialized;
+        return manager;
+    }
+
+    std::filesystem::path PluginsDir()
+    {
+        return std::filesystem::path(Manager().GetPluginsDirectory()) / "examples";
+    }
+
+    // A minimal plugin that exercises the dispatch machinery without
+    // depending on sc4_plugin_base/pydantic
+    const char* kPluginTemplate = R"(
+class _BenchPlugin:
+    def __init__(self, city):
+        self.city = city
+
+    def initialize(self):
+        return True
+
+    def shutdown(self):
+        pass
+
+    def get_subscribed_messages(self):
+        return [0x42000001]
+
+    def handle_message(self, message):
+        return False
+
+    def handle_cheat(self, cheat):
+        return False
+
+    def get_registered_cheats(self):
+        return {'bench:noop': 'benchmark no-op cheat'}
+
+
+plugin_instance = _BenchPlugin
+)";
+
+    // Writes exactly `count` synthetic plugins and reloads so the loaded
+    // set matches; extra files from a previous run are removed
+    void EnsurePluginCount(size_t count)
+    {
+        static size_t currentCount = static_cast<size_t>(-1);
+        if (currentCount == count)
+        {
+            return;
+        }
+
+        auto dir = PluginsDir();
+        std::filesystem::create_directories(dir);
+        std::ofstream(dir / "__init__.py");
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            auto path = dir / ("bench_plugin_" + std::to_string(i) + ".py");
+            if (i < count)
+            {
+                std::ofstream(path) << kPluginTemplate;
+            }
+            else
+            {
+                std::filesystem::remove(path);
+            }
+        }
+
+        Manager().ReloadPlugins();
+        currentCount = count;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Dispatch paths
+// ---------------------------------------------------------------------------
+
+static void BM_HandleCheat(benchmark::State& state)
+{
+    EnsurePluginCount(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Manager().HandleCheat(0x50594348, "bench:noop"));
+    }
+}
+BENCHMARK(BM_HandleCheat)->Arg(1)->Arg(10)->Arg(50);
+
+static void BM_HandleMessage_FanOut(benchmark::State& state)
+{
+    EnsurePluginCount(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Manager().HandleMessage(kSubscribedMessage, nullptr));
+    }
+}
+BENCHMARK(BM_HandleMessage_FanOut)->Arg(1)->Arg(10)->Arg(50);
+
+static void BM_HandleMessage_NoSubscriber(benchmark::State& state)
+{
+    // The pure-C++ early-out: what every uninteresting message costs
+    EnsurePluginCount(10);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Manager().HandleMessage(kUnsubscribedMessage, nullptr));
+    }
+}
+BENCHMARK(BM_HandleMessage_NoSubscriber);
+
+static void BM_CallAllPlugins_CityInit(benchmark::State& state)
+{
+    EnsurePluginCount(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Manager().OnCityInit());
+    }
+}
+BENCHMARK(BM_CallAllPlugins_CityInit)->Arg(1)->Arg(10)->Arg(50);
+
+// ---------------------------------------------------------------------------
+// CityWrapper stats cache
+// ---------------------------------------------------------------------------
+
+static void BM_GetCityStats_Hot(benchmark::State& state)
+{
+    auto city = Manager().GetCityWrapper();
+    city->GetCityStats(); // Prime the cache
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(city->GetCityStats());
+    }
+}
+BENCHMARK(BM_GetCityStats_Hot);
+
+static void BM_GetCityStats_Cold(benchmark::State& state)
+{
+    auto city = Manager().GetCityWrapper();
+    for (auto _ : state)
+    {
+        city->InvalidateStatsCache();
+        benchmark::DoNotOptimize(city->GetCityStats());
+    }
+}
+BENCHMARK(BM_GetCityStats_Cold);
+
+// ---------------------------------------------------------------------------
+// pybind11 crossing cost per sc4_native function
+// ---------------------------------------------------------------------------
+
+static void BM_BindingCrossing(benchmark::State& state)
+{
+    EnsurePluginCount(0);
+    py::gil_scoped_acquire gil;
+
+    py::object wrapper = py::cast(Manager().GetCityWrapper());
+    static const char* kMethods[] = {
+        "is_valid", "get_city_name", "get_city_population", "get_city_money",
+        "get_mayor_mode", "get_city_date", "get_city_time", "get_city_stats",
+        "get_stats_generation"
+    };
+    const char* method = kMethods[state.range(0)];
+    py::object bound = wrapper.attr(method);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bound());
+    }
+    state.SetLabel(method);
+}
+BENCHMARK(BM_BindingCrossing)->DenseRange(0, 8);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,276 @@
+// pybind11 includes MUST be first
+#include <pybind11/embed.h>
+#include <pybind11/pybind11.h>
+namespace py = pybind11;
+
+#include "CheatRegistry.h"
+#include "../utils/Logger.h"
+#include "../utils/PluginStats.h"
+#include "../wrappers/CityWrapper.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct CheatEntry
+    {
+        std::string cheatText;    // Lowercase
+        std::string description;
+        void* handler_ptr = nullptr;  // Heap py::object*, owned by the registry
+        uint32_t cheatID = 0;         // 0 until registered with SC4
+        CheatRegistry::NativeAction nativeAction = CheatRegistry::NativeAction::None;
+    };
+
+    // Keyed by lowercase cheat text; idToText resolves dispatch lookups
+    std::unordered_map<std::string, CheatEntry> s_entries;
+    std::unordered_map<uint32_t, std::string> s_idToText;
+    std::atomic<size_t> s_pendingCount{0};
+    std::mutex s_mutex;
+
+    std::string Lowercase(const std::string& text)
+    {
+        std::string lower = text;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        return lower;
+    }
+
+    // "<cheat> <amount>" -> amount; false when the argument is missing or
+    // not a number
+    bool ParseAmountArgument(const std::string& cheatText, int64_t& amount)
+    {
+        size_t space = cheatText.find_first_of(" \t");
+        if (space == std::string::npos)
+        {
+            return false;
+        }
+        try
+        {
+            amount = std::stoll(cheatText.substr(space + 1));
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+}
+
+void CheatRegistry::Register(const std::string& cheatText, const std::string& description,
+                             void* handler_ptr)
+{
+    std::string lowerText = Lowercase(cheatText);
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    auto it = s_entries.find(lowerText);
+    if (it != s_entries.end())
+    {
+        // Reload path: refresh the handler, keep the SC4-side registration
+        delete static_cast<py::object*>(it->second.handler_ptr);
+        it->second.handler_ptr = handler_ptr;
+        it->second.description = description;
+        LOG_DEBUG("CheatRegistry: refreshed handler for '{}'", lowerText);
+        return;
+    }
+
+    CheatEntry entry;
+    entry.cheatText = lowerText;
+    entry.description = description;
+    entry.handler_ptr = handler_ptr;
+    s_entries[lowerText] = entry;
+    s_pendingCount.fetch_add(1, std::memory_order_release);
+    LOG_INFO("CheatRegistry: registered cheat '{}' ({})", lowerText, description);
+}
+
+CheatRegistry::NativeAction CheatRegistry::ParseNativeAction(const std::string& name)
+{
+    std::string lower = Lowercase(name);
+    if (lower == "get_money") return NativeAction::GetMoney;
+    if (lower == "set_money") return NativeAction::SetMoney;
+    if (lower == "add_money") return NativeAction::AddMoney;
+    if (lower == "toggle_mayor_mode") return NativeAction::ToggleMayorMode;
+    if (lower == "dump_stats") return NativeAction::DumpStats;
+    return NativeAction::None;
+}
+
+void CheatRegistry::RegisterNative(const std::string& cheatText, const std::string& description,
+                                   NativeAction action)
+{
+    std::string lowerText = Lowercase(cheatText);
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    auto it = s_entries.find(lowerText);
+    if (it != s_entries.end())
+    {
+        // Reload path: swap any previous Python handler for the action,
+        // keep the SC4-side registration
+        delete static_cast<py::object*>(it->second.handler_ptr);
+        it->second.handler_ptr = nullptr;
+        it->second.description = description;
+        it->second.nativeAction = action;
+        LOG_DEBUG("CheatRegistry: refreshed native action for '{}'", lowerText);
+        return;
+    }
+
+    CheatEntry entry;
+    entry.cheatText = lowerText;
+    entry.description = description;
+    entry.nativeAction = action;
+    s_entries[lowerText] = entry;
+    s_pendingCount.fetch_add(1, std::memory_order_release);
+    LOG_INFO("CheatRegistry: registered native-fast cheat '{}' ({})", lowerText, description);
+}
+
+bool CheatRegistry::DispatchNative(uint32_t cheatID, const std::string& cheatText,
+                                   CityWrapper& city)
+{
+    NativeAction action = NativeAction::None;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto idIt = s_idToText.find(cheatID);
+        if (idIt == s_idToText.end())
+        {
+            return false;
+        }
+        auto entryIt = s_entries.find(idIt->second);
+        if (entryIt == s_entries.end())
+        {
+            return false;
+        }
+        action = entryIt->second.nativeAction;
+    }
+
+    // Everything below is plain C++ against the wrapper's cached
+    // simulator pointers - the interpreter is never entered
+    int64_t amount = 0;
+    switch (action)
+    {
+        case NativeAction::GetMoney:
+            LOG_INFO("City funds: {}", city.GetCityMoney());
+            Logger::FlushNow();
+            return true;
+
+        case NativeAction::SetMoney:
+            if (!ParseAmountArgument(cheatText, amount))
+            {
+                LOG_WARN("Cheat '{}' needs a numeric amount", cheatText);
+                return true;
+            }
+            if (amount < 0) amount = 0;
+            if (amount > UINT32_MAX) amount = UINT32_MAX;
+            return city.SetCityMoney(static_cast<uint32_t>(amount));
+
+        case NativeAction::AddMoney:
+            if (!ParseAmountArgument(cheatText, amount))
+            {
+                LOG_WARN("Cheat '{}' needs a numeric amount", cheatText);
+                return true;
+            }
+            if (amount < INT32_MIN) amount = INT32_MIN;
+            if (amount > INT32_MAX) amount = INT32_MAX;
+            return city.AddCityMoney(static_cast<int32_t>(amount));
+
+        case NativeAction::ToggleMayorMode:
+            return city.SetMayorMode(!city.GetMayorMode());
+
+        case NativeAction::DumpStats:
+            LOG_INFO("Plugin dispatch statistics:\n{}", PluginStats::FormatReport());
+            Logger::FlushNow();
+            return true;
+
+        case NativeAction::None:
+        default:
+            return false;
+    }
+}
+
+bool CheatRegistry::HasPending()
+{
+    return s_pendingCount.load(std::memory_order_acquire) > 0;
+}
+
+void CheatRegistry::FlushPending(
+    const std::function<uint32_t(const std::string&, const std::string&)>& assignID)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    for (auto& [text, entry] : s_entries)
+    {
+        if (entry.cheatID != 0)
+        {
+            continue;
+        }
+
+        uint32_t cheatID = assignID(entry.cheatText, entry.description);
+        if (cheatID == 0)
+        {
+            continue; // Stays pending; retried at the next flush
+        }
+
+        entry.cheatID = cheatID;
+        s_idToText[cheatID] = text;
+        s_pendingCount.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool CheatRegistry::Owns(uint32_t cheatID)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_idToText.find(cheatID) != s_idToText.end();
+}
+
+bool CheatRegistry::Dispatch(uint32_t cheatID, const std::string& cheatText)
+{
+    void* handlerPtr = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto idIt = s_idToText.find(cheatID);
+        if (idIt == s_idToText.end())
+        {
+            return false;
+        }
+        auto entryIt = s_entries.find(idIt->second);
+        if (entryIt == s_entries.end())
+        {
+            return false;
+        }
+        handlerPtr = entryIt->second.handler_ptr;
+    }
+
+    if (!handlerPtr)
+    {
+        LOG_WARN("CheatRegistry: cheat 0x{:08x} has no handler (plugin unloaded?)", cheatID);
+        return false;
+    }
+
+    try
+    {
+        py::gil_scoped_acquire gil;
+        auto* handler = static_cast<py::object*>(handlerPtr);
+        py::object result = (*handler)(cheatID, cheatText);
+        return result.cast<bool>();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("CheatRegistry: error dispatching cheat '{}': {}", cheatText, e.what());
+        return false;
+    }
+}
+
+void CheatRegistry::ClearHandlers()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto& [text, entry] : s_entries)
+    {
+        delete static_cast<py::object*>(entry.handler_ptr);
+        entry.handler_ptr = nullptr;
+        if (entry.cheatID == 0)
+        {
+            s_pendingCount.fetch_sub(1, std::memory_order_release);
+        }
+    }
+    s_entries.clear();
+    s_idToText.clear();
+    LOG_DEBUG("CheatRegistry: all handlers cleared");
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class CityWrapper;
+
+// Push-based cheat registration shared between the sc4_native binding and
+// the DllDirector. Plugins call sc4_native.register_cheat(text, description,
+// handler) which lands here immediately with the handler object cached; the
+// DllDirector flushes pending entries into SC4's cheat code manager and
+// dispatches issued cheats straight from cheat ID to the bound callable -
+// no per-dispatch plugin iteration and no startup polling pass.
+//
+// Storage follows the framework's no-py-members rule: handlers are heap
+// py::object pointers behind void*, created and destroyed under the GIL.
+class CheatRegistry
+{
+public:
+    // Called from the sc4_native binding with the GIL held. Takes ownership
+    // of handler_ptr (a heap py::object*). Re-registering an existing cheat
+    // text swaps in the new handler - this is how hot-reloaded plugins
+    // refresh their bindings without touching the SC4-side registration.
+    static void Register(const std::string& cheatText, const std::string& description,
+                         void* handler_ptr);
+
+    // Cheap check for the game loop: anything awaiting SC4-side registration?
+    static bool HasPending();
+
+    // Registers every pending cheat with SC4 through assignID, which returns
+    // the cheat ID to bind (or 0 to leave the entry pending). Game thread only.
+    static void FlushPending(
+        const std::function<uint32_t(const std::string& cheatText,
+                                     const std::string& description)>& assignID);
+
+    // Prebuilt native actions for "native-fast" cheats. A cheat bound to
+    // one of these dispatches entirely in C++ against CityWrapper -
+    // parameters parsed from the cheat text, no GIL, no interpreter entry.
+    enum class NativeAction : uint32_t
+    {
+        None = 0,
+        GetMoney,         // Logs current funds
+        SetMoney,         // "<cheat> <amount>"
+        AddMoney,         // "<cheat> <signed amount>"
+        ToggleMayorMode,
+        DumpStats         // Logs the plugin dispatch statistics report
+    };
+
+    // Maps a registration-time action name ("get_money", "set_money",
+    // "add_money", "toggle_mayor_mode", "dump_stats") to its action;
+    // None for anything unknown
+    static NativeAction ParseNativeAction(const std::string& name);
+
+    // Registers a cheat bound to a prebuilt native action instead of a
+    // Python handler. Same pending/flush lifecycle as Register(); safe
+    // to call without the GIL.
+    static void RegisterNative(const std::string& cheatText, const std::string& description,
+                               NativeAction action);
+
+    // Runs the native action bound to the cheat ID, if any, against the
+    // given city. Returns false when the ID is not native-fast so Python
+    // dispatch stays the fallback.
+    static bool DispatchNative(uint32_t cheatID, const std::string& cheatText,
+                               CityWrapper& city);
+
+    // True if the cheat ID was registered through this registry
+    static bool Owns(uint32_t cheatID);
+
+    // Invoke the cached handler for a cheat ID: acquires the GIL, calls
+    // handler(cheat_id, text) and returns its truthiness
+    static bool Dispatch(uint32_t cheatID, const std::string& cheatText);
+
+    // Delete all cached handler objects. GIL must be held. Called when
+    // plugins are unloaded; re-registration repopulates the registry.
+    static void ClearHandlers();
+
+private:
+    CheatRegistry() = default;
+};
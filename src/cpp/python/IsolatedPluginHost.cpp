@@ -0,0 +1,381 @@
+// Raw CPython API only in this translation unit: pybind11 objects belong
+// to the main interpreter and must never leak into a sub-interpreter with
+// its own GIL, so the host speaks plain PyObject* throughout.
+#include <Python.h>
+
+#include "IsolatedPluginHost.h"
+#include "../utils/Logger.h"
+
+#include <filesystem>
+
+namespace
+{
+    // Each worker thread runs exactly one sub-interpreter, so the module
+    // functions below find their host through a thread-local instead of
+    // capsule plumbing
+    thread_local IsolatedPluginHost* t_currentHost = nullptr;
+
+    PyObject* Isolated_GetCitySnapshot(PyObject*, PyObject*)
+    {
+        if (!t_currentHost)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "no isolated host bound to this thread");
+            return nullptr;
+        }
+
+        IsolatedPluginHost::CitySnapshot snap = t_currentHost->CopySnapshot();
+        return Py_BuildValue(
+            "{s:I,s:I,s:I,s:I,s:I,s:I,s:I,s:I,s:I,s:I}",
+            "date", snap.date,
+            "funds", snap.funds,
+            "residential_population", snap.stats.residential_population,
+            "commercial_population", snap.stats.commercial_population,
+            "industrial_population", snap.stats.industrial_population,
+            "total_jobs", snap.stats.total_jobs,
+            "power_produced", snap.stats.power_produced,
+            "power_consumed", snap.stats.power_consumed,
+            "water_produced", snap.stats.water_produced,
+            "water_consumed", snap.stats.water_consumed);
+    }
+
+    PyObject* Isolated_Log(PyObject*, PyObject* args)
+    {
+        int level = 1;
+        const char* message = nullptr;
+        if (!PyArg_ParseTuple(args, "is", &level, &message))
+        {
+            return nullptr;
+        }
+
+        auto logger = Logger::Get();
+        if (logger)
+        {
+            switch (level)
+            {
+                case 0: logger->debug(message); break;
+                case 1: logger->info(message); break;
+                case 2: logger->warn(message); break;
+                case 3: logger->error(message); break;
+                default: logger->info(message); break;
+            }
+        }
+        Py_RETURN_NONE;
+    }
+
+    PyMethodDef kIsolatedMethods[] = {
+        { "get_city_snapshot", Isolated_GetCitySnapshot, METH_NOARGS,
+          "Get the last published city state as a dict of plain ints" },
+        { "log", Isolated_Log, METH_VARARGS,
+          "log(level, message): write to the framework log "
+          "(0=debug, 1=info, 2=warn, 3=error)" },
+        { nullptr, nullptr, 0, nullptr }
+    };
+
+    PyModuleDef kIsolatedModuleDef = {
+        PyModuleDef_HEAD_INIT,
+        "sc4_isolated",
+        "SC4 framework bindings available inside isolated sub-interpreters",
+        -1,
+        kIsolatedMethods,
+        nullptr, nullptr, nullptr, nullptr
+    };
+
+    // Logs and clears any pending Python error with a native prefix so
+    // failures in isolated plugins are attributable in the framework log
+    void LogPythonError(const std::string& context)
+    {
+        if (!PyErr_Occurred())
+        {
+            return;
+        }
+
+        PyObject* type = nullptr;
+        PyObject* value = nullptr;
+        PyObject* traceback = nullptr;
+        PyErr_Fetch(&type, &value, &traceback);
+
+        std::string detail = "<no detail>";
+        if (value)
+        {
+            PyObject* str = PyObject_Str(value);
+            if (str)
+            {
+                const char* utf8 = PyUnicode_AsUTF8(str);
+                if (utf8)
+                {
+                    detail = utf8;
+                }
+                Py_DECREF(str);
+            }
+        }
+        LOG_ERROR("{}: {}", context, detail);
+
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
+    }
+
+    // Imports the plugin module from its file and returns the constructed
+    // plugin instance (new reference), or nullptr with the error logged
+    PyObject* BootstrapPlugin(const std::string& pluginName, const std::string& filepath,
+                              const std::string& scriptsDir)
+    {
+        static const char* kBootstrap = R"PY(
+import importlib.util
+import sys
+
+sys.path.insert(0, scripts_dir)
+spec = importlib.util.spec_from_file_location(plugin_name, plugin_path)
+module = importlib.util.module_from_spec(spec)
+sys.modules[plugin_name] = module
+spec.loader.exec_module(module)
+plugin = module.plugin_instance() if hasattr(module, 'plugin_instance') else None
+)PY";
+
+        PyObject* globals = PyDict_New();
+        if (!globals)
+        {
+            return nullptr;
+        }
+        PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+
+        PyObject* name = PyUnicode_FromString(pluginName.c_str());
+        PyObject* path = PyUnicode_FromString(filepath.c_str());
+        PyObject* scripts = PyUnicode_FromString(scriptsDir.c_str());
+        PyDict_SetItemString(globals, "plugin_name", name);
+        PyDict_SetItemString(globals, "plugin_path", path);
+        PyDict_SetItemString(globals, "scripts_dir", scripts);
+        Py_XDECREF(name);
+        Py_XDECREF(path);
+        Py_XDECREF(scripts);
+
+        PyObject* result = PyRun_String(kBootstrap, Py_file_input, globals, globals);
+        PyObject* plugin = nullptr;
+        if (result)
+        {
+            Py_DECREF(result);
+            plugin = PyDict_GetItemString(globals, "plugin");  // Borrowed
+            Py_XINCREF(plugin);
+        }
+        else
+        {
+            LogPythonError("Isolated plugin " + pluginName + " failed to import");
+        }
+        Py_DECREF(globals);
+        return plugin;
+    }
+}
+
+IsolatedPluginHost::IsolatedPluginHost(std::string pluginName, std::string filepath,
+                                       std::string scriptsDir)
+    : pluginName(std::move(pluginName))
+    , filepath(std::move(filepath))
+    , scriptsDir(std::move(scriptsDir))
+    , stopRequested(false)
+    , ready(false)
+{
+}
+
+IsolatedPluginHost::~IsolatedPluginHost()
+{
+    Stop();
+}
+
+bool IsolatedPluginHost::Start()
+{
+#if PY_VERSION_HEX < 0x030C0000
+    LOG_WARN("Isolated plugin {} needs CPython 3.12+ for own-GIL sub-interpreters; "
+             "not loading it", pluginName);
+    return false;
+#else
+    if (worker.joinable())
+    {
+        return true;
+    }
+    stopRequested = false;
+    worker = std::thread(&IsolatedPluginHost::ThreadMain, this);
+    return true;
+#endif
+}
+
+void IsolatedPluginHost::Stop()
+{
+    if (!worker.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex);
+        stopRequested = true;
+    }
+    inboxCv.notify_all();
+    worker.join();
+}
+
+void IsolatedPluginHost::EnqueueMessage(uint32_t messageType, uint32_t data1,
+                                        uint32_t data2, uint32_t data3)
+{
+    if (!IsSubscribed(messageType))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex);
+        inbox.push_back(GameMessage{ messageType, data1, data2, data3 });
+    }
+    inboxCv.notify_one();
+}
+
+bool IsolatedPluginHost::IsSubscribed(uint32_t messageType) const
+{
+    if (!ready.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    // Immutable once ready, and small: a linear scan beats a hash here
+    for (uint32_t type : subscribedTypes)
+    {
+        if (type == messageType)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void IsolatedPluginHost::PublishSnapshot(const CitySnapshot& newSnapshot)
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    snapshot = newSnapshot;
+}
+
+IsolatedPluginHost::CitySnapshot IsolatedPluginHost::CopySnapshot() const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return snapshot;
+}
+
+void IsolatedPluginHost::ThreadMain()
+{
+#if PY_VERSION_HEX >= 0x030C0000
+    t_currentHost = this;
+
+    // Attach to the main interpreter first: sub-interpreter creation needs
+    // a current thread state. With own_gil the new interpreter takes its
+    // own lock and the main GIL is released again once creation returns.
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    PyThreadState* mainState = PyThreadState_Get();
+
+    PyInterpreterConfig config{};
+    config.use_main_obmalloc = 0;
+    config.allow_fork = 0;
+    config.allow_exec = 0;
+    config.allow_threads = 1;
+    config.allow_daemon_threads = 0;
+    config.check_multi_interp_extensions = 1;
+    config.gil = PyInterpreterConfig_OWN_GIL;
+
+    PyThreadState* interpState = nullptr;
+    PyStatus status = Py_NewInterpreterFromConfig(&interpState, &config);
+    if (PyStatus_Exception(status) || !interpState)
+    {
+        LOG_ERROR("Failed to create sub-interpreter for isolated plugin {}: {}",
+                  pluginName, status.err_msg ? status.err_msg : "unknown error");
+        PyGILState_Release(gilState);
+        t_currentHost = nullptr;
+        return;
+    }
+
+    // Make sc4_isolated importable before the plugin runs
+    PyObject* isolatedModule = PyModule_Create(&kIsolatedModuleDef);
+    if (isolatedModule)
+    {
+        PyObject* modules = PyImport_GetModuleDict();
+        PyDict_SetItemString(modules, "sc4_isolated", isolatedModule);
+    }
+
+    PyObject* plugin = BootstrapPlugin(pluginName, filepath, scriptsDir);
+    if (plugin)
+    {
+        // Fix the subscription set, then open for business
+        PyObject* typeList = PyObject_CallMethod(plugin, "get_subscribed_messages", nullptr);
+        if (typeList && PySequence_Check(typeList))
+        {
+            Py_ssize_t count = PySequence_Size(typeList);
+            for (Py_ssize_t i = 0; i < count; i++)
+            {
+                PyObject* item = PySequence_GetItem(typeList, i);
+                if (item)
+                {
+                    unsigned long value = PyLong_AsUnsignedLong(item);
+                    if (!PyErr_Occurred())
+                    {
+                        subscribedTypes.push_back(static_cast<uint32_t>(value));
+                    }
+                    PyErr_Clear();
+                    Py_DECREF(item);
+                }
+            }
+        }
+        LogPythonError("Isolated plugin " + pluginName + " get_subscribed_messages failed");
+        Py_XDECREF(typeList);
+
+        ready.store(true, std::memory_order_release);
+        LOG_INFO("Isolated plugin {} running in its own interpreter ({} message types)",
+                 pluginName, subscribedTypes.size());
+
+        // Dispatch loop: sleep on the inbox, release this interpreter's
+        // GIL while waiting so plugin-internal threads can run
+        while (true)
+        {
+            GameMessage message{};
+            {
+                PyThreadState* saved = PyEval_SaveThread();
+                std::unique_lock<std::mutex> lock(inboxMutex);
+                inboxCv.wait(lock, [this]() { return stopRequested || !inbox.empty(); });
+                if (stopRequested && inbox.empty())
+                {
+                    lock.unlock();
+                    PyEval_RestoreThread(saved);
+                    break;
+                }
+                message = inbox.front();
+                inbox.pop_front();
+                lock.unlock();
+                PyEval_RestoreThread(saved);
+            }
+
+            PyObject* result = PyObject_CallMethod(plugin, "handle_message", "IIII",
+                                                   message.messageType, message.data1,
+                                                   message.data2, message.data3);
+            if (!result)
+            {
+                LogPythonError("Isolated plugin " + pluginName + " handle_message failed");
+            }
+            Py_XDECREF(result);
+        }
+
+        ready.store(false, std::memory_order_release);
+
+        PyObject* shutdownResult = PyObject_CallMethod(plugin, "shutdown", nullptr);
+        if (!shutdownResult)
+        {
+            PyErr_Clear();  // shutdown() is optional
+        }
+        Py_XDECREF(shutdownResult);
+        Py_DECREF(plugin);
+    }
+
+    Py_XDECREF(isolatedModule);
+    Py_EndInterpreter(interpState);
+
+    // Py_EndInterpreter leaves no current thread state; re-attach to the
+    // main interpreter so the matching release below is balanced
+    PyEval_RestoreThread(mainState);
+    PyGILState_Release(gilState);
+    t_currentHost = nullptr;
+    LOG_INFO("Isolated plugin {} stopped", pluginName);
+#endif
+}
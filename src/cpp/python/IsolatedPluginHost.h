@@ -0,0 +1,104 @@
+#pragma once
+
+// Standard library only - this header must stay free of Python types so
+// PythonManager can hold hosts without widening its include surface
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../wrappers/CityWrapper.h"
+
+// Opt-in isolation mode: a plugin tagged with a "# sc4-isolated" header
+// comment runs in its own sub-interpreter with its own GIL (PEP 684) on a
+// dedicated worker thread, so analytics-class workloads scale across cores
+// instead of time-slicing the simulation thread's interpreter.
+//
+// Nothing Python-level is shared with the main interpreter. Messages
+// arrive as POD structs through a native inbox, and city access goes
+// through an immutable stats snapshot the game thread publishes. Isolated
+// plugins therefore follow a narrower contract than regular ones:
+//   - the module must be importable stand-alone (no sc4_native, and no
+//     extension modules that reject multi-interpreter use)
+//   - plugin_instance() takes no arguments
+//   - handlers receive plain ints: handle_message(type, data1, data2, data3)
+//   - get_subscribed_messages() / shutdown() keep their usual meaning
+//   - city state comes from sc4_isolated.get_city_snapshot(), a dict of
+//     the last published date, funds and CityStats fields
+//
+// Requires CPython 3.12+; Start() fails gracefully on older runtimes.
+class IsolatedPluginHost
+{
+public:
+    // POD snapshot of city state, published by the game thread once per
+    // exec cycle and copied under a small mutex - never a live pointer
+    struct CitySnapshot
+    {
+        uint32_t date = 0;
+        uint32_t funds = 0;
+        CityWrapper::CityStats stats{};
+    };
+
+    IsolatedPluginHost(std::string pluginName, std::string filepath, std::string scriptsDir);
+    ~IsolatedPluginHost();
+
+    IsolatedPluginHost(const IsolatedPluginHost&) = delete;
+    IsolatedPluginHost& operator=(const IsolatedPluginHost&) = delete;
+
+    // Spawns the worker thread, which creates the sub-interpreter and
+    // imports the plugin. Returns false if the runtime lacks own-GIL
+    // sub-interpreter support; import failures surface in the log and
+    // leave the host idle.
+    bool Start();
+
+    // Stops the worker, tears down the sub-interpreter and joins. Must be
+    // called while the main interpreter is still alive and without the
+    // main GIL held on the calling thread.
+    void Stop();
+
+    // One lock plus a POD push; the host drops messages its plugin did
+    // not subscribe to. Safe from the game thread at message rate.
+    void EnqueueMessage(uint32_t messageType, uint32_t data1, uint32_t data2, uint32_t data3);
+
+    // Subscription probe for the DoMessage interest gate. The set is
+    // written once by the worker before it signals ready, then immutable.
+    bool IsSubscribed(uint32_t messageType) const;
+
+    // Game thread publishes, worker copies on demand
+    void PublishSnapshot(const CitySnapshot& snapshot);
+    CitySnapshot CopySnapshot() const;
+
+    const std::string& Name() const { return pluginName; }
+
+private:
+    struct GameMessage
+    {
+        uint32_t messageType;
+        uint32_t data1;
+        uint32_t data2;
+        uint32_t data3;
+    };
+
+    void ThreadMain();
+
+    std::string pluginName;
+    std::string filepath;
+    std::string scriptsDir;
+
+    std::thread worker;
+    std::atomic<bool> stopRequested;
+    std::atomic<bool> ready;  // Set after the subscription list is final
+
+    mutable std::mutex inboxMutex;
+    std::condition_variable inboxCv;
+    std::deque<GameMessage> inbox;
+
+    std::vector<uint32_t> subscribedTypes;  // Immutable once ready
+
+    mutable std::mutex snapshotMutex;
+    CitySnapshot snapshot;
+};
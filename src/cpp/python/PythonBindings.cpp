@@ -4,10 +4,26 @@
 #include <pybind11/functional.h>
 #include "../wrappers/CityWrapper.h"
 #include "../utils/Logger.h"
+#include "../utils/PluginStats.h"
+#include "../utils/StateStore.h"
+#include "CheatRegistry.h"
 #include "cIGZMessage2Standard.h"
 
 namespace py = pybind11;
 
+namespace {
+
+CityWrapper::GridLayer GridLayerFromName(const std::string& layerName)
+{
+    if (layerName == "power") return CityWrapper::GridLayer::Power;
+    if (layerName == "water") return CityWrapper::GridLayer::Water;
+    if (layerName == "traffic") return CityWrapper::GridLayer::Traffic;
+    if (layerName == "land_value") return CityWrapper::GridLayer::LandValue;
+    throw py::value_error("Unknown grid layer: " + layerName);
+}
+
+} // namespace
+
 PYBIND11_EMBEDDED_MODULE(sc4_native, m) {
     m.doc() = "SC4 Python Framework Native Bindings";
 
@@ -20,11 +36,87 @@ PYBIND11_EMBEDDED_MODULE(sc4_native, m) {
         .def("get_city_money", &CityWrapper::GetCityMoney)
         .def("set_city_money", &CityWrapper::SetCityMoney)
         .def("add_city_money", &CityWrapper::AddCityMoney)
+        .def("apply_budget_batch", [](CityWrapper& self, py::sequence deltas) {
+            // One binding crossing for the whole batch: the deltas are
+            // copied into native storage, applied as one simulator
+            // transaction, and the per-entry outcomes returned together
+            std::vector<int32_t> values;
+            values.reserve(py::len(deltas));
+            for (auto item : deltas) {
+                values.push_back(item.cast<int32_t>());
+            }
+            std::vector<uint8_t> applied(values.size(), 0);
+            self.ApplyBudgetBatch(values.data(), values.size(), applied.data());
+
+            py::list result;
+            for (uint8_t entry : applied) {
+                result.append(static_cast<bool>(entry));
+            }
+            return result;
+        }, "Apply a sequence of signed funds adjustments as one transaction: "
+           "a single funds read and clamped write regardless of batch size. "
+           "Returns a list of booleans; False marks entries rejected because "
+           "they would push funds out of range.",
+           py::arg("deltas"))
         .def("get_mayor_mode", &CityWrapper::GetMayorMode)
         .def("set_mayor_mode", &CityWrapper::SetMayorMode)
         .def("get_city_date", &CityWrapper::GetCityDate)
         .def("get_city_time", &CityWrapper::GetCityTime)
-        .def("get_city_stats", &CityWrapper::GetCityStats);
+        .def("get_city_stats", &CityWrapper::GetCityStats)
+        .def("get_grid", [](const CityWrapper& self, const std::string& layer) {
+            const auto& grid = self.GetGridBuffer(GridLayerFromName(layer));
+            // Read-only view over the wrapper-owned storage: Python sees the
+            // grid zero-copy, numpy can wrap it via np.asarray(view)
+            return py::memoryview::from_buffer(
+                grid.cells.data(),
+                { static_cast<py::ssize_t>(grid.height), static_cast<py::ssize_t>(grid.width) },
+                { static_cast<py::ssize_t>(grid.width * sizeof(uint8_t)),
+                  static_cast<py::ssize_t>(sizeof(uint8_t)) });
+        }, "Get a zero-copy row-major uint8 view of a city grid layer "
+           "('power', 'water', 'traffic', 'land_value'). The view is only "
+           "valid until the layer's generation changes.",
+           py::arg("layer"))
+        .def("get_grid_generation", [](const CityWrapper& self, const std::string& layer) {
+            return self.GetGridBuffer(GridLayerFromName(layer)).generation;
+        }, "Get the refresh generation of a grid layer; compare against the "
+           "value observed when the view was taken to detect staleness",
+           py::arg("layer"))
+        .def("configure_stats_recorder", &CityWrapper::ConfigureRecorder,
+             "Set the time-series recorder cadence (sample every Nth sim "
+             "tick) and ring capacity in rows; resets recorded history",
+             py::arg("tick_interval"), py::arg("capacity"))
+        .def("get_stats_history", [](CityWrapper& self) {
+            const auto* rows = self.GetSampleData();
+            auto count = static_cast<py::ssize_t>(self.GetSampleCount());
+            constexpr auto fields = static_cast<py::ssize_t>(CityWrapper::kSampleFieldCount);
+            // Zero-copy 2D uint32 view, oldest row first. Columns: date,
+            // funds, then the CityStats fields in declaration order.
+            return py::memoryview::from_buffer(
+                reinterpret_cast<const uint32_t*>(rows),
+                { count, fields },
+                { fields * static_cast<py::ssize_t>(sizeof(uint32_t)),
+                  static_cast<py::ssize_t>(sizeof(uint32_t)) });
+        }, "Get the recorded stats time series as a zero-copy (rows, fields) "
+           "uint32 view: date, funds, residential/commercial/industrial "
+           "population, total_jobs, power and water produced/consumed. "
+           "Valid until the next sample is recorded.")
+        .def("get_stats_history_count", &CityWrapper::GetSampleCount,
+             "Number of rows currently recorded in the stats time series")
+        .def("get_stats_generation", &CityWrapper::GetStatsGeneration,
+             "Monotonic counter bumped whenever cached city state is "
+             "invalidated; poll this instead of re-fetching CityStats to "
+             "cheaply detect changes")
+        .def("get_city_snapshot", [](const CityWrapper& self) -> py::object {
+            auto snap = std::make_shared<CityWrapper::Snapshot>();
+            if (!self.CopySnapshot(*snap)) {
+                return py::none();
+            }
+            return py::cast(std::move(snap));
+        }, "Get an immutable snapshot of the full city state (date, funds, "
+           "name, stats, grid layers) as published at the end of the last "
+           "exec cycle. The snapshot is an independent copy - unlike the "
+           "live getters it is safe to read from any thread and never goes "
+           "stale underneath you. None until the first cycle completes.");
 
     // CityStats structure
     py::class_<CityWrapper::CityStats>(m, "CityStats")
@@ -37,6 +129,31 @@ PYBIND11_EMBEDDED_MODULE(sc4_native, m) {
         .def_readonly("water_produced", &CityWrapper::CityStats::water_produced)
         .def_readonly("water_consumed", &CityWrapper::CityStats::water_consumed);
 
+    // Snapshot-isolated city state: every field is a copy taken at publish
+    // time, so instances can be handed to worker threads or held across
+    // frames without touching live simulator interfaces
+    py::class_<CityWrapper::Snapshot, std::shared_ptr<CityWrapper::Snapshot>>(m, "CitySnapshot")
+        .def_readonly("generation", &CityWrapper::Snapshot::generation)
+        .def_readonly("date", &CityWrapper::Snapshot::date)
+        .def_readonly("funds", &CityWrapper::Snapshot::funds)
+        .def_readonly("stats", &CityWrapper::Snapshot::stats)
+        .def_readonly("name", &CityWrapper::Snapshot::name)
+        .def("get_grid", [](const CityWrapper::Snapshot& self, const std::string& layer) {
+            const auto& grid = self.grids[static_cast<size_t>(GridLayerFromName(layer))];
+            // Owned copy rather than a view: snapshot consumers hand grids
+            // to worker threads, and bytes has no lifetime to get wrong
+            return py::bytes(reinterpret_cast<const char*>(grid.cells.data()),
+                             grid.cells.size());
+        }, "Get a snapshotted grid layer ('power', 'water', 'traffic', "
+           "'land_value') as row-major uint8 bytes; pair with "
+           "get_grid_size for the dimensions",
+           py::arg("layer"))
+        .def("get_grid_size", [](const CityWrapper::Snapshot& self, const std::string& layer) {
+            const auto& grid = self.grids[static_cast<size_t>(GridLayerFromName(layer))];
+            return py::make_tuple(grid.height, grid.width);
+        }, "Get (rows, cols) of a snapshotted grid layer",
+           py::arg("layer"));
+
     // SC4 Message wrapper (minimal exposure for safety)
     py::class_<cIGZMessage2Standard>(m, "SC4Message")
         .def("get_type", &cIGZMessage2Standard::GetType)
@@ -56,6 +173,155 @@ PYBIND11_EMBEDDED_MODULE(sc4_native, m) {
     m.attr("CHEAT_POWER") = 0x1DE4F79A;
     m.attr("CHEAT_WATER") = 0x1DE4F79B;
     
+    // Push-based cheat registration: the handler is cached natively and
+    // invoked as handler(cheat_id, text) -> bool when the cheat is issued,
+    // without iterating plugins. The framework registers the cheat with
+    // SC4 at the next safe point on the game thread.
+    m.def("register_cheat", [](const std::string& cheat_text, const std::string& description,
+                               py::object handler) {
+        CheatRegistry::Register(cheat_text, description, new py::object(std::move(handler)));
+    }, "Register a cheat command with a handler callable. The handler is "
+       "called as handler(cheat_id, text) and should return True when it "
+       "handled the cheat. Re-registering the same text replaces the handler.",
+       py::arg("cheat_text"), py::arg("description"), py::arg("handler"));
+
+    // Native-fast cheats: the cheat text is bound to a prebuilt C++ action
+    // on CityWrapper at registration time, so issuing the cheat never
+    // enters the interpreter. Everything else goes through register_cheat.
+    m.def("register_native_cheat", [](const std::string& cheat_text, const std::string& description,
+                                      const std::string& action) {
+        CheatRegistry::NativeAction native = CheatRegistry::ParseNativeAction(action);
+        if (native == CheatRegistry::NativeAction::None) {
+            throw py::value_error("Unknown native action: " + action);
+        }
+        CheatRegistry::RegisterNative(cheat_text, description, native);
+    }, "Register a cheat bound to a prebuilt native action ('get_money', "
+       "'set_money', 'add_money', 'toggle_mayor_mode', 'dump_stats'). "
+       "Amount-taking actions parse it from the cheat text, e.g. "
+       "'mycheat 50000'. Dispatch runs entirely in C++.",
+       py::arg("cheat_text"), py::arg("description"), py::arg("action"));
+
+    // The framework-owned asyncio loop, stashed here by PythonManager
+    // when it creates the loop. asyncio.get_event_loop() is thread-local
+    // and the loop is created on the background init thread, so plugins
+    // must resolve it through this accessor rather than asyncio.
+    m.attr("_event_loop") = py::none();
+    m.def("get_event_loop", []() -> py::object {
+        return py::module::import("sc4_native").attr("_event_loop");
+    }, "Get the framework's asyncio event loop - the one PumpAsyncTasks "
+       "steps each frame. Schedule coroutines on this loop (or via "
+       "SC4PluginBase.schedule); tasks created on any other loop never "
+       "run. None until the framework finishes initializing.");
+
+    // Per-city persistent state store. Values are typed natively so a
+    // round trip gives back what was put in; the framework opens the
+    // store at city init and flushes it write-behind in the background.
+    // Plugins normally go through the dict-like wrapper in
+    // sc4_plugin_base rather than calling these directly.
+    m.def("state_put", [](const std::string& key, py::object value) {
+        StateStore::Value entry;
+        if (py::isinstance<py::bytes>(value)) {
+            std::string bytes = value.cast<std::string>();
+            entry.type = StateStore::ValueType::Bytes;
+            entry.data.assign(bytes.begin(), bytes.end());
+        } else if (py::isinstance<py::str>(value)) {
+            std::string text = value.cast<std::string>();
+            entry.type = StateStore::ValueType::Str;
+            entry.data.assign(text.begin(), text.end());
+        } else if (py::isinstance<py::bool_>(value)) {
+            throw py::type_error("state_put: bool is not a stored type; use int");
+        } else if (py::isinstance<py::int_>(value)) {
+            int64_t number = value.cast<int64_t>();
+            entry.type = StateStore::ValueType::Int;
+            entry.data.resize(sizeof(number));
+            memcpy(entry.data.data(), &number, sizeof(number));
+        } else if (py::isinstance<py::float_>(value)) {
+            double number = value.cast<double>();
+            entry.type = StateStore::ValueType::Float;
+            entry.data.resize(sizeof(number));
+            memcpy(entry.data.data(), &number, sizeof(number));
+        } else {
+            throw py::type_error("state_put: value must be bytes, str, int or float");
+        }
+        StateStore::Put(key, std::move(entry));
+    }, "Store a bytes/str/int/float value in the per-city persistent "
+       "store. Writes land in memory immediately and reach disk within "
+       "the write-behind flush interval.",
+       py::arg("key"), py::arg("value"));
+
+    m.def("state_get", [](const std::string& key, py::object fallback) -> py::object {
+        StateStore::Value entry;
+        if (!StateStore::Get(key, entry)) {
+            return fallback;
+        }
+        switch (entry.type) {
+            case StateStore::ValueType::Bytes:
+                return py::bytes(reinterpret_cast<const char*>(entry.data.data()),
+                                 entry.data.size());
+            case StateStore::ValueType::Str:
+                return py::str(std::string(entry.data.begin(), entry.data.end()));
+            case StateStore::ValueType::Int: {
+                int64_t number = 0;
+                memcpy(&number, entry.data.data(), sizeof(number));
+                return py::int_(number);
+            }
+            case StateStore::ValueType::Float: {
+                double number = 0.0;
+                memcpy(&number, entry.data.data(), sizeof(number));
+                return py::float_(number);
+            }
+        }
+        return fallback;
+    }, "Get a value from the per-city persistent store, or the default "
+       "when the key is absent. Reads are memory-speed after city load.",
+       py::arg("key"), py::arg("default") = py::none());
+
+    m.def("state_delete", [](const std::string& key) {
+        return StateStore::Erase(key);
+    }, "Remove a key from the per-city persistent store; returns False "
+       "when it was not present",
+       py::arg("key"));
+
+    m.def("state_keys", []() {
+        return StateStore::Keys();
+    }, "List all keys in the per-city persistent store");
+
+    m.def("state_flush", []() {
+        StateStore::FlushNow();
+    }, "Force a synchronous flush of the per-city persistent store; "
+       "normal saves should rely on the background write-behind flush");
+
+    // Dispatch timing recorded by PythonManager around every plugin call;
+    // one list entry per plugin method with recorded activity
+    m.def("get_plugin_stats", []() {
+        py::list result;
+        for (const auto& snapshot : PluginStats::Snapshot()) {
+            for (size_t i = 0; i < static_cast<size_t>(PluginStats::Method::Count); i++) {
+                const auto& stats = snapshot.methods[i];
+                if (stats.callCount == 0) {
+                    continue;
+                }
+                py::dict entry;
+                entry["plugin"] = snapshot.pluginName;
+                entry["method"] = PluginStats::MethodName(static_cast<PluginStats::Method>(i));
+                entry["count"] = stats.callCount;
+                entry["total_us"] = stats.totalMicros;
+                entry["p50_us"] = PluginStats::PercentileMicros(stats, 0.50);
+                entry["p99_us"] = PluginStats::PercentileMicros(stats, 0.99);
+                entry["max_us"] = stats.maxMicros;
+                entry["overruns"] = snapshot.budgetOverruns;
+                result.append(entry);
+            }
+        }
+        return result;
+    }, "Get per-plugin dispatch timing (count, total and percentile latency "
+       "in microseconds) for handle_message, handle_cheat and on_city_init, "
+       "plus the plugin's frame-budget overrun count");
+
+    m.def("reset_plugin_stats", []() {
+        PluginStats::Reset();
+    }, "Zero all plugin dispatch timing counters");
+
     // Logging functions for Python integration
     m.def("log_message", [](const std::string& message, int level) {
         auto logger = Logger::Get();
@@ -2,17 +2,217 @@
 #include "PythonManager.h"
 
 // Other includes after pybind11
+#include "CheatRegistry.h"
+#include "IsolatedPluginHost.h"
+#include "PythonWorkQueue.h"
 #include "../wrappers/CityWrapper.h"
 #include "../utils/Logger.h"
+#include "../utils/PluginStats.h"
+#include "../utils/StartupProfiler.h"
 #include "cIGZMessage2.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <windows.h>
 
 
+namespace
+{
+    // Time-budget scheduler defaults. A plugin can override its budget by
+    // implementing get_frame_budget_us(); the base class returns the same
+    // default. Three consecutive overruns demote the plugin for eight
+    // inline handler calls so one misbehaving handler cannot keep eating
+    // the frame.
+    constexpr uint32_t kDefaultFrameBudgetMicros = 2000;
+    constexpr uint32_t kOverrunDemoteThreshold = 3;
+    constexpr uint32_t kThrottlePenaltyCalls = 8;
+
+    // Bound-method handles resolved once at LoadPlugin() time. A
+    // default-constructed (null) py::object means the plugin does not
+    // implement that method.
+    struct PluginMethodCache
+    {
+        py::object handleCheat;
+        py::object handleMessage;
+        py::object onCityInit;
+        py::object onCityShutdown;
+        py::object shutdown;
+        py::object getRegisteredCheats;
+    };
+
+    // The per-plugin Python state: instance handle plus the bound-method
+    // cache in a single heap allocation behind PluginSlot::runtime_ptr
+    // (no py::object members may exist before the interpreter is
+    // initialized, so the registry slots in the header hold only a void*).
+    // Subscription registry entries point at methods.handleMessage inside
+    // this block; it stays put until the slot is retired, which happens
+    // only after the subscriptions are cleared and the work queue drained.
+    struct PluginRuntime
+    {
+        py::object instance;
+        PluginMethodCache methods;
+    };
+
+    // Attribute names and dispatch-path callables interned once after
+    // interpreter init. Every name the dispatch and load paths touch lives
+    // here as a py::str created (and hashed) a single time, instead of
+    // allocating a fresh PyUnicode per lookup. Heap allocated behind
+    // PythonManager::interned_ptr for the same reason as the method cache:
+    // no py::object members may exist before the interpreter is initialized.
+    struct InternedTable
+    {
+        py::str handle_cheat{"handle_cheat"};
+        py::str handle_message{"handle_message"};
+        py::str on_city_init{"on_city_init"};
+        py::str on_city_shutdown{"on_city_shutdown"};
+        py::str shutdown{"shutdown"};
+        py::str get_registered_cheats{"get_registered_cheats"};
+        py::str initialize{"initialize"};
+        py::str plugin_instance{"plugin_instance"};
+        py::str get_subscribed_messages{"get_subscribed_messages"};
+        py::str get_deferrable_messages{"get_deferrable_messages"};
+        py::str get_frame_budget_us{"get_frame_budget_us"};
+
+        // Pooled constructors from sc4_types, bound once so the per-event
+        // path pays neither a module import nor an attribute lookup
+        py::object acquireMessage;
+        py::object acquireCheat;
+
+        // The framework-owned asyncio event loop and its pre-bound pump
+        // methods. The loop never blocks: PumpAsyncTasks() steps it with
+        // call_soon(stop) + run_forever until a per-frame deadline.
+        py::object asyncLoop;
+        py::object loopCallSoon;
+        py::object loopStop;
+        py::object loopRunForever;
+        py::object loopReady;      // The loop's _ready callback queue, if exposed
+        py::object createTask;
+        py::object allTasks;
+        py::object isCoroutine;
+
+        bool BindAsyncLoop()
+        {
+            try
+            {
+                py::module asyncio = py::module::import("asyncio");
+                asyncLoop = asyncio.attr("new_event_loop")();
+                asyncio.attr("set_event_loop")(asyncLoop);
+                loopCallSoon = asyncLoop.attr("call_soon");
+                loopStop = asyncLoop.attr("stop");
+                loopRunForever = asyncLoop.attr("run_forever");
+                createTask = asyncLoop.attr("create_task");
+                allTasks = asyncio.attr("all_tasks");
+                isCoroutine = asyncio.attr("iscoroutine");
+
+                // BaseEventLoop's ready-callback deque: lets the pump stop
+                // as soon as nothing is runnable instead of spinning out
+                // its budget against timer-parked tasks. Private, so treat
+                // it as optional - absent, the pump steps once per frame.
+                loopReady = py::getattr(asyncLoop, "_ready", py::none());
+
+                // set_event_loop() above only binds the loop to this
+                // (background init) thread; plugins on the game thread
+                // resolve it through sc4_native.get_event_loop() instead
+                py::module::import("sc4_native").attr("_event_loop") = asyncLoop;
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARN("Could not set up the asyncio event loop: {}", e.what());
+                return false;
+            }
+        }
+
+        void CloseAsyncLoop()
+        {
+            if (!asyncLoop)
+            {
+                return;
+            }
+            try
+            {
+                // Cancel whatever is still pending, spin one iteration so
+                // the cancellations are delivered, then close
+                for (auto task : allTasks(asyncLoop))
+                {
+                    task.attr("cancel")();
+                }
+                loopCallSoon(loopStop);
+                loopRunForever();
+                asyncLoop.attr("close")();
+                py::module::import("sc4_native").attr("_event_loop") = py::none();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARN("Error closing the asyncio event loop: {}", e.what());
+            }
+            asyncLoop = py::object();
+            loopCallSoon = py::object();
+            loopStop = py::object();
+            loopRunForever = py::object();
+            loopReady = py::object();
+            createTask = py::object();
+            allTasks = py::object();
+            isCoroutine = py::object();
+        }
+
+        bool BindTypes()
+        {
+            try
+            {
+                py::module sc4_types = py::module::import("sc4_types");
+                acquireMessage = sc4_types.attr("acquire_message");
+                acquireCheat = sc4_types.attr("acquire_cheat");
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARN("Could not bind sc4_types constructors: {}", e.what());
+                return false;
+            }
+        }
+    };
+
+    py::object ResolveMethod(const py::object& instance, const py::str& name)
+    {
+        return py::hasattr(instance, name) ? instance.attr(name) : py::object();
+    }
+
+    // Logs how long each Initialize() phase takes so startup cost stays
+    // attributable to a specific phase; also lands in the startup
+    // profiler's JSON report under an "init:" prefix
+    struct PhaseTimer
+    {
+        const char* name;
+        std::chrono::steady_clock::time_point start;
+        StartupProfiler::Scope profile;
+
+        explicit PhaseTimer(const char* phaseName)
+            : name(phaseName)
+            , start(std::chrono::steady_clock::now())
+            , profile(std::string("init:") + phaseName)
+        {
+        }
+
+        ~PhaseTimer()
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            LOG_INFO("Init phase '{}' took {} ms", name, elapsed);
+        }
+    };
+}
+
+
 PythonManager::PythonManager()
 {
     this->pythonInitialized = false;
+    this->initState = InitState::NotStarted;
+    this->mainThreadState = nullptr;
+    this->interned_ptr = nullptr;
     this->cityWrapper = std::make_unique<CityWrapper>();
 }
 
@@ -33,13 +233,17 @@ bool PythonManager::Initialize()
     try
     {
         LOG_INFO("Initializing Python interpreter...");
-        
-        // Initialize interpreter - this must persist for the lifetime of the object
-        interpreter = std::make_unique<py::scoped_interpreter>();
+
+        {
+            PhaseTimer timer("interpreter");
+            // Initialize interpreter - this must persist for the lifetime of the object
+            interpreter = std::make_unique<py::scoped_interpreter>();
+        }
         LOG_INFO("Python interpreter initialized successfully");
 
         // Import the native sc4_native module to make it available to Python
         try {
+            PhaseTimer timer("sc4_native import");
             py::module sc4_native = py::module::import("sc4_native");
             LOG_INFO("sc4_native module imported successfully");
         } catch (const std::exception& e) {
@@ -48,29 +252,80 @@ bool PythonManager::Initialize()
             return false;
         }
 
-        if (!SetupPythonPaths())
         {
-            SetError("Failed to setup Python paths");
-            return false;
+            PhaseTimer timer("SetupPythonPaths");
+            if (!SetupPythonPaths())
+            {
+                SetError("Failed to setup Python paths");
+                return false;
+            }
         }
-        
-        if (!SetupPythonEnvironment())
+
+        {
+            PhaseTimer timer("SetupBytecodeBundle");
+            if (!SetupBytecodeBundle())
+            {
+                LOG_WARN("Bytecode bundle unavailable, importing framework modules from loose files");
+            }
+        }
+
         {
-            LOG_WARN("Failed to setup Python environment, proceeding with basic functionality");
+            PhaseTimer timer("SetupPythonEnvironment");
+            if (!SetupPythonEnvironment())
+            {
+                LOG_WARN("Failed to setup Python environment, proceeding with basic functionality");
+            }
         }
 
-        if (!LoadPythonBootstrap())
         {
-            SetError("Failed to load Python bootstrap code");
-            return false;
+            PhaseTimer timer("LoadPythonBootstrap");
+            if (!LoadPythonBootstrap())
+            {
+                SetError("Failed to load Python bootstrap code");
+                return false;
+            }
         }
-        
+
         // Set up Python logging integration
-        if (!SetupPythonLogging())
         {
-            LOG_WARN("Failed to setup Python logging integration, proceeding anyway");
+            PhaseTimer timer("SetupPythonLogging");
+            if (!SetupPythonLogging())
+            {
+                LOG_WARN("Failed to setup Python logging integration, proceeding anyway");
+            }
+        }
+
+        // Compile plugin sources ahead of the import loop: when Initialize()
+        // runs on the background thread this overlaps SC4's own loading,
+        // and LoadPlugins() later only unmarshals warm bytecode
+        {
+            PhaseTimer timer("PrecompilePlugins");
+            PrecompilePluginSources();
         }
 
+        // Intern the attribute names and bind the sc4_types constructors the
+        // dispatch paths use, so per-event work is pure call cost
+        {
+            PhaseTimer timer("InternedTable");
+            auto* interned = new InternedTable();
+            interned->BindTypes();
+            interned_ptr = interned;
+        }
+
+        // Framework-owned asyncio loop for coroutine handlers; pumped from
+        // the game's idle callback with a per-frame deadline
+        {
+            PhaseTimer timer("AsyncLoop");
+            static_cast<InternedTable*>(interned_ptr)->BindAsyncLoop();
+        }
+
+        // Start the worker thread for deferrable plugin handlers, then
+        // release the GIL on this thread. From here on every path that
+        // touches Python (game thread or worker) acquires it scoped.
+        workQueue = std::make_unique<PythonWorkQueue>();
+        workQueue->Start();
+        mainThreadState = PyEval_SaveThread();
+
         pythonInitialized = true;
         LOG_INFO("Python environment initialized successfully");
         return true;
@@ -83,21 +338,141 @@ bool PythonManager::Initialize()
     }
 }
 
+bool PythonManager::InitializeAsync()
+{
+    InitState expected = InitState::NotStarted;
+    if (!initState.compare_exchange_strong(expected, InitState::InProgress))
+    {
+        LOG_INFO("InitializeAsync called but initialization already {}",
+                 expected == InitState::InProgress ? "in progress" : "finished");
+        return true;
+    }
+
+    LOG_INFO("Starting Python initialization on background thread...");
+    initThread = std::thread([this]() {
+        // The interpreter is created on this thread; Initialize() releases
+        // the GIL at its end, so ownership transfers cleanly to whichever
+        // thread acquires it next.
+        bool ok = Initialize();
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            initState.store(ok ? InitState::Succeeded : InitState::Failed);
+        }
+        initCv.notify_all();
+
+        // Py_Finalize must run on the thread that ran Py_Initialize, so
+        // park here until Shutdown() posts finalization over; the thread
+        // costs nothing while waiting
+        std::unique_lock<std::mutex> lock(initMutex);
+        initCv.wait(lock, [this]() { return finalizeRequested; });
+        lock.unlock();
+        FinalizePython();
+    });
+    return true;
+}
+
+bool PythonManager::WaitForInitialization()
+{
+    if (initState.load() == InitState::NotStarted)
+    {
+        // Async mode was never started; fall back to synchronous init
+        initState.store(InitState::InProgress);
+        bool ok = Initialize();
+        initState.store(ok ? InitState::Succeeded : InitState::Failed);
+        return ok;
+    }
+
+    if (initThread.joinable())
+    {
+        // The init thread stays parked for interpreter finalization, so
+        // wait on its completion signal rather than joining
+        auto start = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(initMutex);
+        initCv.wait(lock, [this]() { return initState.load() != InitState::InProgress; });
+        lock.unlock();
+        auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        LOG_INFO("PostAppInit waited {} ms for background Python init", waited);
+    }
+
+    return initState.load() == InitState::Succeeded;
+}
+
 void PythonManager::Shutdown()
+{
+    if (!pythonInitialized && !initThread.joinable()) return;
+
+    LOG_INFO("Starting Python shutdown sequence...");
+
+    // Stop the worker thread before teardown so no deferred task runs
+    // against plugins that are being unloaded
+    if (workQueue)
+    {
+        workQueue->Stop();
+        workQueue->DrainCompletions();
+        workQueue.reset();
+    }
+
+    // Isolated hosts briefly attach to the main interpreter during
+    // teardown, so stop them before the finalizing thread takes the GIL
+    for (auto& host : isolatedHosts)
+    {
+        host->Stop();
+    }
+    isolatedHosts.clear();
+
+    // Finalization must run on the thread that created the interpreter.
+    // After async init that is the parked init thread: restoring its
+    // tstate here would hold the GIL with this thread's own cached
+    // pybind11 tstate stale, and gil_scoped_acquire would self-deadlock
+    // re-taking the lock. Post the teardown over and join; after the
+    // synchronous fallback this thread is the creator, so run it inline.
+    if (initThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(initMutex);
+            finalizeRequested = true;
+        }
+        initCv.notify_all();
+        initThread.join();
+    }
+    else
+    {
+        FinalizePython();
+    }
+}
+
+void PythonManager::FinalizePython()
 {
     if (!pythonInitialized) return;
 
     try
     {
-        LOG_INFO("Starting Python shutdown sequence...");
-        
+        // Re-take the GIL released at the end of Initialize(); plugin
+        // teardown and interpreter finalization need it held here
+        if (mainThreadState)
+        {
+            PyEval_RestoreThread(mainThreadState);
+            mainThreadState = nullptr;
+        }
+
         // Unload all plugins first
         UnloadPlugins();
-        
+
+        // Free the interned strings and bound callables while the
+        // interpreter still exists
+        if (interned_ptr)
+        {
+            auto* interned = static_cast<InternedTable*>(interned_ptr);
+            interned->CloseAsyncLoop();
+            delete interned;
+            interned_ptr = nullptr;
+        }
+
         // Destroy interpreter (automatically handled by scoped_interpreter destructor)
         LOG_INFO("Shutting down Python interpreter...");
         interpreter.reset();
-        
+
         pythonInitialized = false;
         LOG_INFO("Python environment shut down successfully");
     }
@@ -117,19 +492,46 @@ bool PythonManager::LoadPlugins()
 
     try
     {
-        auto pluginFiles = DiscoverPluginFiles();
+        LoadPluginManifest();
+
+        auto pluginFiles = SortPluginsByDependencies(DiscoverPluginFiles());
         LOG_INFO("Found {} plugin files", pluginFiles.size());
 
         bool allLoaded = true;
         for (const auto& filepath : pluginFiles)
         {
-            if (!LoadPlugin(filepath))
+            // Isolated plugins never enter the main interpreter: they get
+            // their own sub-interpreter, GIL and worker thread
+            if (IsIsolatedPlugin(filepath))
+            {
+                if (!StartIsolatedPlugin(filepath))
+                {
+                    allLoaded = false;
+                }
+                continue;
+            }
+
+            // Skip files whose last import failed and that have not changed
+            // since; retrying them every launch only costs startup time
+            auto manifestIt = pluginManifest.find(filepath);
+            if (manifestIt != pluginManifest.end() && !manifestIt->second.lastLoadOk &&
+                IsPluginUnchanged(filepath))
+            {
+                LOG_DEBUG("Skipping unchanged plugin that failed to load previously: {}", filepath);
+                allLoaded = false;
+                continue;
+            }
+
+            bool loadOk = LoadPlugin(filepath);
+            UpdateManifestEntry(filepath, loadOk);
+            if (!loadOk)
             {
                 LOG_WARN("Failed to load plugin: {}", filepath);
                 allLoaded = false;
             }
         }
 
+        SavePluginManifest();
         return allLoaded;
     }
     catch (const std::exception& e)
@@ -143,19 +545,42 @@ void PythonManager::UnloadPlugins()
 {
     try
     {
-        for (auto& [name, plugin] : loadedPlugins)
+        // Isolated hosts first, and before taking the main GIL: their
+        // teardown briefly attaches to the main interpreter, which would
+        // deadlock against a GIL held on this thread
+        for (auto& host : isolatedHosts)
+        {
+            host->Stop();
+        }
+        isolatedHosts.clear();
+
+        // Let in-flight deferred handlers finish before their bound handles
+        // are freed. Must happen before taking the GIL - the worker needs it.
+        if (workQueue)
+        {
+            workQueue->WaitForIdle();
+            workQueue->DrainCompletions();
+        }
+
+        py::gil_scoped_acquire gil;
+        for (auto& slot : plugins)
         {
-            if (plugin.loaded && plugin.instance_ptr)
+            if (slot.loaded && slot.runtime_ptr)
             {
-                CallPluginMethod(name, "shutdown");
-                
-                // Clean up the py::object pointer
-                delete static_cast<py::object*>(plugin.instance_ptr);
-                plugin.instance_ptr = nullptr;
-                plugin.loaded = false;
+                CallPluginMethod(slot, PluginMethod::Shutdown);
+
+                ClearMessageSubscriptions(slot.name);
+
+                RetirePluginSlot(slot);
             }
         }
-        loadedPlugins.clear();
+        plugins.clear();
+        pluginIndex.clear();
+
+        // Cached cheat handlers reference the plugin instances freed above;
+        // plugins re-register through sc4_native.register_cheat on reload
+        CheatRegistry::ClearHandlers();
+
         LOG_INFO("All plugins unloaded");
     }
     catch (const std::exception& e)
@@ -166,43 +591,251 @@ void PythonManager::UnloadPlugins()
 
 bool PythonManager::ReloadPlugins()
 {
-    UnloadPlugins();
-    return LoadPlugins();
+    if (!pythonInitialized)
+    {
+        SetError("Python not initialized");
+        return false;
+    }
+
+    try
+    {
+        auto pluginFiles = SortPluginsByDependencies(DiscoverPluginFiles());
+
+        // Plugins whose backing file disappeared get unloaded
+        std::vector<std::string> removed;
+        for (const auto& slot : plugins)
+        {
+            if (slot.loaded &&
+                std::find(pluginFiles.begin(), pluginFiles.end(), slot.filepath) == pluginFiles.end())
+            {
+                removed.push_back(slot.name);
+            }
+        }
+        for (const auto& name : removed)
+        {
+            UnloadPlugin(name);
+        }
+
+        // Reload cost is O(changed plugins): unchanged modules keep their
+        // instances, cached handles and registered cheats untouched
+        bool allSucceeded = true;
+        size_t reloadedCount = 0, addedCount = 0;
+        for (const auto& filepath : pluginFiles)
+        {
+            std::string pluginName = std::filesystem::path(filepath).stem().string();
+
+            // Isolated plugins live outside the registry; a newly tagged
+            // file gets a host, a running host keeps its interpreter
+            if (IsIsolatedPlugin(filepath))
+            {
+                bool hostRunning = std::any_of(
+                    isolatedHosts.begin(), isolatedHosts.end(),
+                    [&](const std::unique_ptr<IsolatedPluginHost>& host) {
+                        return host->Name() == pluginName;
+                    });
+                if (!hostRunning && !StartIsolatedPlugin(filepath))
+                {
+                    allSucceeded = false;
+                }
+                continue;
+            }
+
+            bool isLoaded = pluginIndex.find(pluginName) != pluginIndex.end();
+
+            if (isLoaded && IsPluginUnchanged(filepath))
+            {
+                continue;
+            }
+
+            bool loadOk;
+            if (isLoaded)
+            {
+                loadOk = ReloadPlugin(pluginName);
+                reloadedCount++;
+            }
+            else
+            {
+                loadOk = LoadPlugin(filepath);
+                UpdateManifestEntry(filepath, loadOk);
+                addedCount++;
+            }
+
+            if (!loadOk)
+            {
+                allSucceeded = false;
+            }
+        }
+
+        SavePluginManifest();
+        LOG_INFO("ReloadPlugins: {} reloaded, {} added, {} removed, {} unchanged",
+                 reloadedCount, addedCount, removed.size(),
+                 pluginFiles.size() - reloadedCount - addedCount);
+        return allSucceeded;
+    }
+    catch (const std::exception& e)
+    {
+        SetError("Failed to reload plugins: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool PythonManager::ReloadPlugin(const std::string& pluginName)
+{
+    PluginSlot* slot = FindPlugin(pluginName);
+    if (!slot || !slot->loaded)
+    {
+        SetError("Plugin not loaded: " + pluginName);
+        return false;
+    }
+
+    std::string filepath = slot->filepath;
+    LOG_INFO("Reloading plugin: {}", pluginName);
+
+    // Let in-flight deferred handlers finish before this plugin's bound
+    // handles are freed. Must happen before taking the GIL.
+    if (workQueue)
+    {
+        workQueue->WaitForIdle();
+        workQueue->DrainCompletions();
+    }
+
+    try
+    {
+        py::gil_scoped_acquire gil;
+
+        // Tear down only this plugin's runtime; the slot (and its handle)
+        // stays assigned so the reloaded instance lands in the same place
+        CallPluginMethod(*slot, PluginMethod::Shutdown);
+        ClearMessageSubscriptions(pluginName);
+        RetirePluginSlot(*slot);
+
+        // Re-import the changed module in place; importlib.reload keeps the
+        // module object identity so other modules holding references see
+        // the new code too
+        std::string moduleName = "examples." + pluginName;
+        py::module importlib = py::module::import("importlib");
+        py::object pluginModule = py::module::import(moduleName.c_str());
+        pluginModule = importlib.attr("reload")(pluginModule);
+
+        if (!py::hasattr(pluginModule, "plugin_instance")) {
+            LOG_WARN("Reloaded plugin {} no longer has 'plugin_instance' attribute", pluginName);
+            pluginIndex.erase(pluginName);
+            slot->name.clear();
+            return false;
+        }
+
+        py::object pluginClass = pluginModule.attr("plugin_instance");
+        py::object pluginInstance = pluginClass(cityWrapper);
+
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        auto* runtime = new PluginRuntime();
+        runtime->instance = pluginInstance;
+        runtime->methods.handleCheat = ResolveMethod(pluginInstance, interned->handle_cheat);
+        runtime->methods.handleMessage = ResolveMethod(pluginInstance, interned->handle_message);
+        runtime->methods.onCityInit = ResolveMethod(pluginInstance, interned->on_city_init);
+        runtime->methods.onCityShutdown = ResolveMethod(pluginInstance, interned->on_city_shutdown);
+        runtime->methods.shutdown = ResolveMethod(pluginInstance, interned->shutdown);
+        runtime->methods.getRegisteredCheats = ResolveMethod(pluginInstance, interned->get_registered_cheats);
+
+        slot->runtime_ptr = runtime;
+        slot->loaded = true;
+
+        // Re-read the frame budget and give the reloaded code a clean
+        // scheduler slate
+        slot->budgetMicros = kDefaultFrameBudgetMicros;
+        slot->overrunStreak = 0;
+        slot->throttlePenalty = 0;
+        if (py::hasattr(pluginInstance, interned->get_frame_budget_us)) {
+            slot->budgetMicros = pluginInstance.attr(interned->get_frame_budget_us)().cast<uint32_t>();
+        }
+
+        if (py::hasattr(pluginInstance, interned->initialize)) {
+            bool initResult = pluginInstance.attr(interned->initialize)().cast<bool>();
+            if (!initResult) {
+                LOG_WARN("Reloaded plugin {} initialize() returned false", pluginName);
+                UnloadPlugin(pluginName);
+                UpdateManifestEntry(filepath, false);
+                SavePluginManifest();
+                return false;
+            }
+        }
+
+        // Re-bind only this plugin's handler caches
+        RegisterMessageSubscriptions(pluginName);
+
+        UpdateManifestEntry(filepath, true);
+        SavePluginManifest();
+        LOG_INFO("Successfully reloaded plugin: {}", pluginName);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Failed to reload plugin {}: {}", pluginName, e.what());
+        UpdateManifestEntry(filepath, false);
+        SavePluginManifest();
+        return false;
+    }
 }
 
 // Simplified implementations without py::args for now
-bool PythonManager::CallPluginMethod(const std::string& pluginName, const std::string& method)
+bool PythonManager::CallPluginMethod(const std::string& pluginName, PluginMethod method)
 {
-    auto it = loadedPlugins.find(pluginName);
-    if (it == loadedPlugins.end() || !it->second.loaded || !it->second.instance_ptr)
+    PluginSlot* slot = FindPlugin(pluginName);
+    if (!slot || !slot->loaded || !slot->runtime_ptr)
     {
         return false;
     }
+    return CallPluginMethod(*slot, method);
+}
 
+bool PythonManager::CallPluginMethod(PluginSlot& slot, PluginMethod method)
+{
     try
     {
-        auto* plugin = static_cast<py::object*>(it->second.instance_ptr);
-        if (py::hasattr(*plugin, method.c_str()))
+        py::gil_scoped_acquire gil;
+        auto& methods = static_cast<PluginRuntime*>(slot.runtime_ptr)->methods;
+        const py::object* handler = nullptr;
+        switch (method)
+        {
+            case PluginMethod::HandleCheat:         handler = &methods.handleCheat; break;
+            case PluginMethod::HandleMessage:       handler = &methods.handleMessage; break;
+            case PluginMethod::OnCityInit:          handler = &methods.onCityInit; break;
+            case PluginMethod::OnCityShutdown:      handler = &methods.onCityShutdown; break;
+            case PluginMethod::Shutdown:            handler = &methods.shutdown; break;
+            case PluginMethod::GetRegisteredCheats: handler = &methods.getRegisteredCheats; break;
+        }
+
+        if (handler && *handler)
         {
-            plugin->attr(method.c_str())();
+            if (method == PluginMethod::OnCityInit)
+            {
+                PluginStats::ScopedTimer timer(slot.statsSlot,
+                                               PluginStats::Method::OnCityInit);
+                (*handler)();
+            }
+            else
+            {
+                (*handler)();
+            }
         }
         return true;
     }
     catch (const std::exception& e)
     {
-        LOG_ERROR("Error calling {} on {}: {}", method, pluginName, e.what());
+        LOG_ERROR("Error calling method {} on {}: {}", static_cast<int>(method), slot.name, e.what());
         return false;
     }
 }
 
-bool PythonManager::CallAllPlugins(const std::string& method)
+bool PythonManager::CallAllPlugins(PluginMethod method)
 {
+    // Dense broadcast over the slot arena - no hash-map iteration
     bool allSucceeded = true;
-    for (const auto& [name, plugin] : loadedPlugins)
+    for (auto& slot : plugins)
     {
-        if (plugin.loaded)
+        if (slot.loaded && slot.runtime_ptr)
         {
-            if (!CallPluginMethod(name, method))
+            if (!CallPluginMethod(slot, method))
             {
                 allSucceeded = false;
             }
@@ -223,94 +856,338 @@ bool PythonManager::HandleMessage(cIGZMessage2& message)
 bool PythonManager::HandleMessage(uint32_t messageType, cIGZMessage2Standard* pMessage)
 {
     if (!pythonInitialized) return false;
-    
-    LOG_DEBUG("HandleMessage with type 0x{:08x} called", messageType);
-    
-    try {
-        // Import SC4Message from sc4_types
-        py::module sc4_types = py::module::import("sc4_types");
-        py::object SC4Message = sc4_types.attr("SC4Message");
-        
-        // Create an SC4Message object
-        py::dict messageArgs;
-        messageArgs["message_type"] = messageType;
-        if (pMessage) {
-            messageArgs["data1"] = pMessage->GetData1();
-            messageArgs["data2"] = pMessage->GetData2();
-            messageArgs["data3"] = pMessage->GetData3();
+
+    // Isolated hosts run on their own interpreters; delivery is a POD
+    // enqueue with no GIL, and the host drops unsubscribed types itself
+    if (!isolatedHosts.empty())
+    {
+        uint32_t hostData1 = 0, hostData2 = 0, hostData3 = 0;
+        if (pMessage)
+        {
+            hostData1 = pMessage->GetData1();
+            hostData2 = pMessage->GetData2();
+            hostData3 = pMessage->GetData3();
         }
-        
-        py::object sc4Message = SC4Message(**messageArgs);
-        
-        // Forward message to all loaded plugins
-        for (const auto& [pluginName, plugin] : loadedPlugins) {
-            if (plugin.loaded && plugin.instance_ptr) {
-                auto* pluginObj = static_cast<py::object*>(plugin.instance_ptr);
-                if (py::hasattr(*pluginObj, "handle_message")) {
-                    py::object result = pluginObj->attr("handle_message")(sc4Message);
+        for (auto& host : isolatedHosts)
+        {
+            host->EnqueueMessage(messageType, hostData1, hostData2, hostData3);
+        }
+    }
+
+    // Native early-out: if no plugin subscribed to this message type we skip
+    // the module import, SC4Message construction and plugin fan-out entirely.
+    auto subIt = messageSubscribers.find(messageType);
+    if (subIt == messageSubscribers.end() || subIt->second.empty())
+    {
+        return true;
+    }
+
+    // Extract the message payload natively - no GIL needed for this
+    uint32_t data1 = 0, data2 = 0, data3 = 0;
+    if (pMessage) {
+        data1 = pMessage->GetData1();
+        data2 = pMessage->GetData2();
+        data3 = pMessage->GetData3();
+    }
+
+    // Deferrable handlers only cost an enqueue on the game thread; the
+    // worker thread acquires the GIL and runs them off-frame
+    bool hasInlineSubscribers = false;
+    for (const auto& subscriber : subIt->second) {
+        if (subscriber.deferrable && workQueue) {
+            EnqueueDeferredMessage(subscriber, messageType, data1, data2, data3);
+        } else {
+            hasInlineSubscribers = true;
+        }
+    }
+
+    if (!hasInlineSubscribers)
+    {
+        return true;
+    }
+
+    LOG_DEBUG_BIN("HandleMessage with type 0x{:08x} called ({} subscribers)", messageType, subIt->second.size());
+
+    try {
+        py::gil_scoped_acquire gil;
+
+        // Pooled SC4Message through the pre-bound sc4_types constructor:
+        // no module import, no attribute lookup, no validation re-run
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        if (!interned->acquireMessage && !interned->BindTypes())
+        {
+            return false;
+        }
+        py::object sc4Message = interned->acquireMessage(messageType, data1, data2, data3);
+
+        // Forward message only to the plugins that declared interest,
+        // through their pre-resolved handle_message handlers
+        for (const auto& subscriber : subIt->second) {
+            if (subscriber.deferrable && workQueue) {
+                continue; // Already enqueued above
+            }
+
+            // Time-budget scheduler: a demoted plugin sits out its penalty
+            // window, so a misbehaving handler costs one decrement instead
+            // of another over-budget call. Handlers not declared deferrable
+            // are skipped rather than pushed to the worker thread - running
+            // them off-thread without the plugin's consent is not safe.
+            PluginSlot& owner = plugins[subscriber.pluginHandle];
+            if (owner.throttlePenalty > 0) {
+                owner.throttlePenalty--;
+                continue;
+            }
+
+            auto* handler = static_cast<py::object*>(subscriber.handler_ptr);
+            uint64_t elapsedMicros = 0;
+            bool cooperative = false;
+            {
+                PluginStats::ScopedTimer timer(subscriber.statsSlot,
+                                               PluginStats::Method::HandleMessage);
+                py::object result = (*handler)(sc4Message);
+                elapsedMicros = timer.ElapsedMicros();
+
+                // An async def handler returns its coroutine immediately;
+                // the real work runs in PumpAsyncTasks() slices, so it is
+                // scheduled on the framework loop instead of cast to bool
+                if (interned->createTask &&
+                    interned->isCoroutine(result).cast<bool>()) {
+                    interned->createTask(result);
+                    cooperative = true;
+                } else if (result.cast<bool>()) {
                     // If plugin returns True, it handled the message
-                    if (result.cast<bool>()) {
-                        LOG_DEBUG("Message 0x{:08x} handled by plugin: {}", messageType, pluginName);
+                    LOG_DEBUG_BIN("Message 0x{:08x} handled by plugin: {}", messageType, subscriber.pluginName);
+                }
+            }
+
+            // Budget check: integer compares on top of the timestamps the
+            // dispatch timer already took. Cooperative handlers returned
+            // immediately and pay for their work out of the pump budget,
+            // so they are never charged an overrun here.
+            if (!cooperative && owner.budgetMicros > 0) {
+                if (elapsedMicros > owner.budgetMicros) {
+                    PluginStats::RecordOverrun(owner.statsSlot);
+                    if (++owner.overrunStreak >= kOverrunDemoteThreshold) {
+                        owner.throttlePenalty = kThrottlePenaltyCalls;
+                        owner.overrunStreak = 0;
+                        LOG_WARN("Plugin {} exceeded its {} us frame budget {} times in a row; "
+                                 "skipping its next {} inline handler calls",
+                                 owner.name, owner.budgetMicros, kOverrunDemoteThreshold,
+                                 kThrottlePenaltyCalls);
                     }
+                } else {
+                    owner.overrunStreak = 0;
                 }
             }
         }
         return true;
-        
+
     } catch (const std::exception& e) {
         LOG_ERROR("Error handling message 0x{:08x}: {}", messageType, e.what());
         return false;
     }
 }
 
+void PythonManager::DrainCompletedWork()
+{
+    if (workQueue)
+    {
+        workQueue->DrainCompletions();
+    }
+}
+
+bool PythonManager::PumpAsyncTasks(uint32_t budgetMicros)
+{
+    if (!pythonInitialized)
+    {
+        return false;
+    }
+    auto* interned = static_cast<InternedTable*>(interned_ptr);
+    if (!interned || !interned->asyncLoop)
+    {
+        return true;
+    }
+
+    try
+    {
+        py::gil_scoped_acquire gil;
+
+        // Idle loop: one len() call and out
+        if (py::len(interned->allTasks(interned->asyncLoop)) == 0)
+        {
+            return true;
+        }
+
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::microseconds(budgetMicros);
+        do
+        {
+            // One loop iteration: runs everything currently ready, then
+            // stops instead of blocking on the selector. Continuations
+            // made ready by that iteration run in the next one, so a long
+            // await chain keeps progressing until the deadline.
+            interned->loopCallSoon(interned->loopStop);
+            interned->loopRunForever();
+
+            if (py::len(interned->allTasks(interned->asyncLoop)) == 0)
+            {
+                break;
+            }
+
+            // Tasks remain but none may be runnable: when every one of
+            // them is parked on a timer or future, iterating again does
+            // nothing. Stop as soon as the ready queue is empty instead
+            // of spinning the rest of the budget; without the queue
+            // handle, settle for one iteration per pump.
+            if (interned->loopReady.is_none() ||
+                py::len(interned->loopReady) == 0)
+            {
+                break;
+            }
+        } while (std::chrono::steady_clock::now() < deadline);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Error pumping async tasks: {}", e.what());
+        return false;
+    }
+}
+
+bool PythonManager::IsMessageSubscribed(uint32_t messageType) const
+{
+    if (messageSubscribers.find(messageType) != messageSubscribers.end())
+    {
+        return true;
+    }
+    for (const auto& host : isolatedHosts)
+    {
+        if (host->IsSubscribed(messageType))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PythonManager::PublishCityState()
+{
+    if (isolatedHosts.empty() || !cityWrapper)
+    {
+        return;
+    }
+
+    // Pure native reads - the snapshot the hosts see is a copy, so an
+    // isolated plugin mid-read never observes the simulation mutating it
+    IsolatedPluginHost::CitySnapshot snapshot;
+    snapshot.date = cityWrapper->GetCityDate();
+    snapshot.funds = cityWrapper->GetCityMoney();
+    snapshot.stats = cityWrapper->GetCityStats();
+
+    for (auto& host : isolatedHosts)
+    {
+        host->PublishSnapshot(snapshot);
+    }
+}
+
+void PythonManager::EnqueueDeferredMessage(const MessageSubscriber& subscriber, uint32_t messageType,
+                                           uint32_t data1, uint32_t data2, uint32_t data3)
+{
+    // Capture only PODs and the registry-owned handler pointer; the handler
+    // stays valid until UnloadPlugin, which waits for the queue to drain
+    // before freeing it. Copying a py::object here would need the GIL.
+    void* handlerPtr = subscriber.handler_ptr;
+    std::string pluginName = subscriber.pluginName;
+    int statsSlot = subscriber.statsSlot;
+
+    // The table outlives every queued task: Shutdown() stops the queue
+    // before freeing it
+    auto* interned = static_cast<InternedTable*>(interned_ptr);
+
+    workQueue->Enqueue([interned, handlerPtr, pluginName, statsSlot, messageType, data1, data2, data3]() {
+        py::gil_scoped_acquire gil;
+        try
+        {
+            if (!interned->acquireMessage && !interned->BindTypes())
+            {
+                return;
+            }
+            py::object sc4Message = interned->acquireMessage(messageType, data1, data2, data3);
+            auto* handler = static_cast<py::object*>(handlerPtr);
+            PluginStats::ScopedTimer timer(statsSlot, PluginStats::Method::HandleMessage);
+            py::object result = (*handler)(sc4Message);
+            if (interned->isCoroutine && interned->isCoroutine(result).cast<bool>())
+            {
+                // The framework loop is pumped on the game thread; a task
+                // created here would race it. Deferrable handlers must
+                // stay synchronous.
+                result.attr("close")();
+                LOG_WARN("Plugin {} declared message 0x{:08x} deferrable but handles it "
+                         "with a coroutine; the handler was not run", pluginName, messageType);
+            }
+            else if (result.cast<bool>())
+            {
+                LOG_DEBUG_BIN("Deferred message 0x{:08x} handled by plugin: {}", messageType, pluginName);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Error in deferred handler for plugin {}: {}", pluginName, e.what());
+        }
+    });
+}
+
 bool PythonManager::HandleCheat(uint32_t cheatID, const std::string& cheatText)
 {
     if (!pythonInitialized) {
-        LOG_WARN("HandleCheat called but Python not initialized");
+        if (initState.load() == InitState::InProgress) {
+            LOG_DEBUG("HandleCheat ignored - Python still initializing");
+        } else {
+            LOG_WARN("HandleCheat called but Python not initialized");
+        }
         return false;
     }
     
     LOG_INFO("HandleCheat called - ID: 0x{:08x}, Text: '{}'", cheatID, cheatText);
     
     try {
-        LOG_DEBUG("Step 1: Importing sc4_types module");
-        py::module sc4_types = py::module::import("sc4_types");
-        
-        LOG_DEBUG("Step 2: Getting CheatCommand class");
-        py::object CheatCommand = sc4_types.attr("CheatCommand");
-        
-        LOG_DEBUG("Step 3: Creating CheatCommand arguments");
-        py::dict cheatArgs;
-        cheatArgs["cheat_id"] = cheatID;
-        cheatArgs["text"] = cheatText;
-        
-        LOG_DEBUG("Step 4: Creating CheatCommand object");
-        py::object cheatCommand = CheatCommand(**cheatArgs);
-        LOG_DEBUG("Step 5: CheatCommand created successfully");
-        
-        // Call all plugins with the CheatCommand object
-        for (const auto& [pluginName, plugin] : loadedPlugins) {
-            if (plugin.loaded && plugin.instance_ptr) {
+        py::gil_scoped_acquire gil;
+
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        if (!interned->acquireCheat && !interned->BindTypes())
+        {
+            return false;
+        }
+
+        LOG_DEBUG("Step 1: Acquiring pooled CheatCommand object");
+        py::object cheatCommand = interned->acquireCheat(cheatID, cheatText);
+        LOG_DEBUG("Step 2: CheatCommand acquired successfully");
+
+        // Broadcast over the dense slot arena with the CheatCommand object
+        for (auto& slot : plugins) {
+            if (slot.loaded && slot.runtime_ptr) {
                 try {
-                    LOG_DEBUG("Step 6: Processing plugin: {}", pluginName);
-                    auto* pluginObj = static_cast<py::object*>(plugin.instance_ptr);
-                    
-                    if (py::hasattr(*pluginObj, "handle_cheat")) {
-                        LOG_DEBUG("Step 7: Calling handle_cheat on plugin: {}", pluginName);
-                        py::object result = pluginObj->attr("handle_cheat")(cheatCommand);
-                        
-                        LOG_DEBUG("Step 8: Got result from plugin {}", pluginName);
+                    LOG_DEBUG("Step 3: Processing plugin: {}", slot.name);
+                    auto& methods = static_cast<PluginRuntime*>(slot.runtime_ptr)->methods;
+
+                    if (methods.handleCheat) {
+                        LOG_DEBUG("Step 4: Calling handle_cheat on plugin: {}", slot.name);
+                        PluginStats::ScopedTimer timer(slot.statsSlot,
+                                                       PluginStats::Method::HandleCheat);
+                        py::object result = methods.handleCheat(cheatCommand);
+
+                        LOG_DEBUG("Step 5: Got result from plugin {}", slot.name);
                         // If any plugin handles the cheat and returns True, consider it processed
                         if (result.cast<bool>()) {
-                            LOG_INFO("Cheat '{}' handled by plugin: {}", cheatText, pluginName);
+                            LOG_INFO("Cheat '{}' handled by plugin: {}", cheatText, slot.name);
                             return true;
                         }
-                        LOG_DEBUG("Step 9: Plugin {} returned false", pluginName);
+                        LOG_DEBUG("Step 6: Plugin {} returned false", slot.name);
                     } else {
-                        LOG_DEBUG("Plugin {} does not have handle_cheat method", pluginName);
+                        LOG_DEBUG("Plugin {} does not have handle_cheat method", slot.name);
                     }
                 } catch (const std::exception& e) {
-                    LOG_ERROR("Error calling handle_cheat on plugin {}: {}", pluginName, e.what());
+                    LOG_ERROR("Error calling handle_cheat on plugin {}: {}", slot.name, e.what());
                     // Continue to next plugin rather than failing completely
                 }
             }
@@ -329,135 +1206,344 @@ bool PythonManager::HandleCheat(uint32_t cheatID, const std::string& cheatText)
 bool PythonManager::HandleCheatForPlugin(uint32_t cheatID, const std::string& cheatText, const std::string& pluginName)
 {
     if (!pythonInitialized) {
-        LOG_WARN("HandleCheatForPlugin called but Python not initialized");
+        if (initState.load() == InitState::InProgress) {
+            LOG_DEBUG("HandleCheatForPlugin ignored - Python still initializing");
+        } else {
+            LOG_WARN("HandleCheatForPlugin called but Python not initialized");
+        }
         return false;
     }
     
     LOG_INFO("HandleCheatForPlugin called - ID: 0x{:08x}, Text: '{}', Plugin: '{}'", cheatID, cheatText, pluginName);
     
     try {
-        LOG_DEBUG("Step 1: Importing sc4_types module");
-        py::module sc4_types = py::module::import("sc4_types");
-        
-        LOG_DEBUG("Step 2: Getting CheatCommand class");
-        py::object CheatCommand = sc4_types.attr("CheatCommand");
-        
-        LOG_DEBUG("Step 3: Creating CheatCommand arguments");
-        py::dict cheatArgs;
-        cheatArgs["cheat_id"] = cheatID;
-        cheatArgs["text"] = cheatText;
-        
-        LOG_DEBUG("Step 4: Creating CheatCommand object");
-        py::object cheatCommand = CheatCommand(**cheatArgs);
-        LOG_DEBUG("Step 5: CheatCommand created successfully");
-        
+        py::gil_scoped_acquire gil;
+
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        if (!interned->acquireCheat && !interned->BindTypes())
+        {
+            return false;
+        }
+
+        LOG_DEBUG("Step 1: Acquiring pooled CheatCommand object");
+        py::object cheatCommand = interned->acquireCheat(cheatID, cheatText);
+        LOG_DEBUG("Step 2: CheatCommand acquired successfully");
+
         // Call specific plugin with the CheatCommand object
-        auto pluginIter = loadedPlugins.find(pluginName);
-        if (pluginIter != loadedPlugins.end() && pluginIter->second.loaded && pluginIter->second.instance_ptr) {
+        PluginSlot* slot = FindPlugin(pluginName);
+        if (slot && slot->loaded && slot->runtime_ptr) {
             try {
-                LOG_DEBUG("Step 6: Processing specific plugin: {}", pluginName);
-                auto* pluginObj = static_cast<py::object*>(pluginIter->second.instance_ptr);
-                
-                if (py::hasattr(*pluginObj, "handle_cheat")) {
-                    LOG_DEBUG("Step 7: Calling handle_cheat on plugin: {}", pluginName);
-                    py::object result = pluginObj->attr("handle_cheat")(cheatCommand);
-                    
-                    LOG_DEBUG("Step 8: Got result from plugin {}", pluginName);
+                LOG_DEBUG("Step 3: Processing specific plugin: {}", pluginName);
+                auto& methods = static_cast<PluginRuntime*>(slot->runtime_ptr)->methods;
+
+                if (methods.handleCheat) {
+                    LOG_DEBUG("Step 4: Calling handle_cheat on plugin: {}", pluginName);
+                    PluginStats::ScopedTimer timer(slot->statsSlot,
+                                                   PluginStats::Method::HandleCheat);
+                    py::object result = methods.handleCheat(cheatCommand);
+
+                    LOG_DEBUG("Step 5: Got result from plugin {}", pluginName);
                     if (result.cast<bool>()) {
                         LOG_INFO("Cheat '{}' handled by plugin: {}", cheatText, pluginName);
                         return true;
                     }
-                    LOG_DEBUG("Step 9: Plugin {} returned false", pluginName);
+                    LOG_DEBUG("Step 6: Plugin {} returned false", pluginName);
                 } else {
                     LOG_DEBUG("Plugin {} does not have handle_cheat method", pluginName);
                 }
             } catch (const std::exception& e) {
                 LOG_ERROR("Error calling handle_cheat on plugin {}: {}", pluginName, e.what());
             }
-        } else {
-            LOG_WARN("Plugin '{}' not found or not loaded", pluginName);
+        } else {
+            LOG_WARN("Plugin '{}' not found or not loaded", pluginName);
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Error in HandleCheatForPlugin: {}", e.what());
+        return false;
+    }
+    
+    LOG_WARN("Plugin '{}' did not handle cheat '{}' (ID: 0x{:08x})", pluginName, cheatText, cheatID);
+    return false;
+}
+
+bool PythonManager::OnCityInit()
+{
+    if (!pythonInitialized) return true;
+
+    try
+    {
+        cityWrapper->UpdateCityReference();
+        return CallAllPlugins(PluginMethod::OnCityInit);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Error in city init: {}", e.what());
+        return true;
+    }
+}
+
+bool PythonManager::OnCityShutdown()
+{
+    if (!pythonInitialized) return true;
+
+    try
+    {
+        bool result = CallAllPlugins(PluginMethod::OnCityShutdown);
+        // Drop the city and cached simulator pointers together; they all
+        // die with the city
+        cityWrapper->ClearCityReference();
+        return result;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Error in city shutdown: {}", e.what());
+        return true;
+    }
+}
+
+std::vector<std::string> PythonManager::DiscoverPluginFiles() const
+{
+    std::vector<std::string> pluginFiles;
+    std::string scriptsDir = GetPluginsDirectory();
+    
+    // Look for plugins in an "examples" subdirectory to avoid loading framework files
+    std::string pluginsDir = scriptsDir + "\\examples";
+
+    try
+    {
+        if (!std::filesystem::exists(pluginsDir))
+        {
+            LOG_WARN("Plugins directory does not exist: {}", pluginsDir);
+            LOG_INFO("Expected plugin location: {}", pluginsDir);
+            return pluginFiles;
+        }
+
+        LOG_INFO("Searching for plugins in: {}", pluginsDir);
+        
+        for (const auto& entry : std::filesystem::directory_iterator(pluginsDir))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".py")
+            {
+                std::string filename = entry.path().filename().string();
+                // Skip files starting with underscore or common non-plugin files
+                if (filename[0] != '_' && 
+                    filename != "setup_deps.py" &&
+                    filename != "__init__.py")
+                {
+                    pluginFiles.push_back(entry.path().string());
+                    LOG_INFO("Found potential plugin: {}", filename);
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Error discovering plugins: {}", e.what());
+    }
+
+    return pluginFiles;
+}
+
+bool PythonManager::IsIsolatedPlugin(const std::string& filepath)
+{
+    // Same header-comment convention as the dependency declarations: a
+    // line starting with "# sc4-isolated" opts the plugin into its own
+    // sub-interpreter. Scanned natively, so routing costs a few line reads.
+    static const std::string kTag = "# sc4-isolated";
+
+    std::ifstream file(filepath);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos)
+        {
+            continue;
+        }
+        if (line[start] != '#')
+        {
+            break;
+        }
+        if (line.compare(start, kTag.size(), kTag) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PythonManager::StartIsolatedPlugin(const std::string& filepath)
+{
+    std::string pluginName = std::filesystem::path(filepath).stem().string();
+
+    auto host = std::make_unique<IsolatedPluginHost>(pluginName, filepath,
+                                                     GetPluginsDirectory());
+    if (!host->Start())
+    {
+        LOG_WARN("Could not start isolated plugin: {}", pluginName);
+        return false;
+    }
+
+    LOG_INFO("Started isolated plugin host: {}", pluginName);
+    isolatedHosts.push_back(std::move(host));
+    return true;
+}
+
+std::vector<std::string> PythonManager::ParseDeclaredDependencies(const std::string& filepath)
+{
+    // Plugins declare load-order dependencies in a header comment:
+    //     # sc4-requires: other_plugin, another_plugin
+    // Only the comment block at the top of the file is scanned, so the
+    // cost is a few line reads per plugin and no GIL.
+    static const std::string kTag = "# sc4-requires:";
+
+    std::vector<std::string> deps;
+    std::ifstream file(filepath);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos)
+        {
+            continue; // Blank lines may separate header comments
+        }
+        if (line[start] != '#')
+        {
+            break; // First code line ends the header
+        }
+        if (line.compare(start, kTag.size(), kTag) != 0)
+        {
+            continue;
+        }
+
+        // Module names after the tag, separated by commas or whitespace
+        std::string token;
+        for (size_t i = start + kTag.size(); i <= line.size(); i++)
+        {
+            char c = i < line.size() ? line[i] : ',';
+            if (std::isalnum(static_cast<unsigned char>(c)) || c == '_')
+            {
+                token += c;
+            }
+            else if (!token.empty())
+            {
+                deps.push_back(token);
+                token.clear();
+            }
         }
-    } catch (const std::exception& e) {
-        LOG_ERROR("Error in HandleCheatForPlugin: {}", e.what());
-        return false;
     }
-    
-    LOG_WARN("Plugin '{}' did not handle cheat '{}' (ID: 0x{:08x})", pluginName, cheatText, cheatID);
-    return false;
+    return deps;
 }
 
-bool PythonManager::OnCityInit()
+std::vector<std::string> PythonManager::SortPluginsByDependencies(
+    const std::vector<std::string>& files) const
 {
-    if (!pythonInitialized) return true;
-
-    try
+    std::unordered_map<std::string, size_t> byName;
+    for (size_t i = 0; i < files.size(); i++)
     {
-        cityWrapper->UpdateCityReference();
-        return CallAllPlugins("on_city_init");
+        byName[std::filesystem::path(files[i]).stem().string()] = i;
     }
-    catch (const std::exception& e)
+
+    // Build dependency -> dependent edges; unmet[i] counts how many of
+    // plugin i's requirements have not been loaded yet
+    std::vector<std::vector<size_t>> dependents(files.size());
+    std::vector<size_t> unmet(files.size(), 0);
+    for (size_t i = 0; i < files.size(); i++)
     {
-        LOG_ERROR("Error in city init: {}", e.what());
-        return true;
+        for (const auto& dep : ParseDeclaredDependencies(files[i]))
+        {
+            auto it = byName.find(dep);
+            if (it == byName.end())
+            {
+                LOG_WARN("Plugin {} requires unknown plugin '{}'; ignoring that requirement",
+                         std::filesystem::path(files[i]).stem().string(), dep);
+                continue;
+            }
+            if (it->second == i)
+            {
+                continue; // Self-dependency is meaningless
+            }
+            dependents[it->second].push_back(i);
+            unmet[i]++;
+        }
     }
-}
-
-bool PythonManager::OnCityShutdown()
-{
-    if (!pythonInitialized) return true;
 
-    try
+    // Kahn's algorithm, seeded in discovery order so plugins without
+    // dependencies keep their familiar load order
+    std::vector<std::string> ordered;
+    ordered.reserve(files.size());
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        if (unmet[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+    for (size_t n = 0; n < ready.size(); n++)
     {
-        return CallAllPlugins("on_city_shutdown");
+        size_t i = ready[n];
+        ordered.push_back(files[i]);
+        for (size_t dependent : dependents[i])
+        {
+            if (--unmet[dependent] == 0)
+            {
+                ready.push_back(dependent);
+            }
+        }
     }
-    catch (const std::exception& e)
+
+    // A cycle leaves plugins with unmet requirements; load them in
+    // discovery order rather than dropping them
+    if (ordered.size() != files.size())
     {
-        LOG_ERROR("Error in city shutdown: {}", e.what());
-        return true;
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            if (unmet[i] > 0)
+            {
+                LOG_WARN("Plugin {} is part of a dependency cycle; loading in discovery order",
+                         std::filesystem::path(files[i]).stem().string());
+                ordered.push_back(files[i]);
+            }
+        }
     }
+    return ordered;
 }
 
-std::vector<std::string> PythonManager::DiscoverPluginFiles() const
+bool PythonManager::PrecompilePluginSources()
 {
-    std::vector<std::string> pluginFiles;
-    std::string scriptsDir = GetPluginsDirectory();
-    
-    // Look for plugins in an "examples" subdirectory to avoid loading framework files
-    std::string pluginsDir = scriptsDir + "\\examples";
-
+    // Moving parse and codegen cost out of the import loop: compileall
+    // skips up-to-date .pyc files, so a steady-state launch pays one stat
+    // per plugin here and the imports in LoadPlugins() only unmarshal
     try
     {
-        if (!std::filesystem::exists(pluginsDir))
+        auto pluginFiles = DiscoverPluginFiles();
+        if (pluginFiles.empty())
         {
-            LOG_WARN("Plugins directory does not exist: {}", pluginsDir);
-            LOG_INFO("Expected plugin location: {}", pluginsDir);
-            return pluginFiles;
+            return true;
         }
 
-        LOG_INFO("Searching for plugins in: {}", pluginsDir);
-        
-        for (const auto& entry : std::filesystem::directory_iterator(pluginsDir))
+        py::module compileall = py::module::import("compileall");
+        size_t compiled = 0;
+        for (const auto& filepath : pluginFiles)
         {
-            if (entry.is_regular_file() && entry.path().extension() == ".py")
+            if (compileall.attr("compile_file")(filepath, "quiet"_a = 2).cast<bool>())
             {
-                std::string filename = entry.path().filename().string();
-                // Skip files starting with underscore or common non-plugin files
-                if (filename[0] != '_' && 
-                    filename != "setup_deps.py" &&
-                    filename != "__init__.py")
-                {
-                    pluginFiles.push_back(entry.path().string());
-                    LOG_INFO("Found potential plugin: {}", filename);
-                }
+                compiled++;
+            }
+            else
+            {
+                LOG_WARN("Failed to precompile plugin source: {}", filepath);
             }
         }
+        LOG_INFO("Precompiled {} of {} plugin sources", compiled, pluginFiles.size());
+        return compiled == pluginFiles.size();
     }
     catch (const std::exception& e)
     {
-        LOG_ERROR("Error discovering plugins: {}", e.what());
+        LOG_WARN("Plugin precompilation skipped: {}", e.what());
+        return false;
     }
-
-    return pluginFiles;
 }
 
 std::string PythonManager::GetPluginsDirectory() const
@@ -475,6 +1561,122 @@ std::string PythonManager::GetPluginsDirectory() const
     return pythonScriptsPath.string();
 }
 
+std::string PythonManager::GetManifestPath() const
+{
+    return (std::filesystem::path(GetPluginsDirectory()) / "plugin_manifest.cache").string();
+}
+
+void PythonManager::LoadPluginManifest()
+{
+    pluginManifest.clear();
+
+    try
+    {
+        std::ifstream manifest(GetManifestPath());
+        if (!manifest.is_open())
+        {
+            return; // First run, or cache was deleted - full validation happens anyway
+        }
+
+        // One tab-separated record per plugin: filepath, mtime, size, load result
+        std::string line;
+        while (std::getline(manifest, line))
+        {
+            std::istringstream fields(line);
+            ManifestEntry entry;
+            std::string mtimeStr, sizeStr, okStr;
+            if (std::getline(fields, entry.filepath, '\t') &&
+                std::getline(fields, mtimeStr, '\t') &&
+                std::getline(fields, sizeStr, '\t') &&
+                std::getline(fields, okStr))
+            {
+                entry.mtime = std::stoull(mtimeStr);
+                entry.size = std::stoull(sizeStr);
+                entry.lastLoadOk = (okStr == "1");
+                pluginManifest[entry.filepath] = entry;
+            }
+        }
+
+        LOG_INFO("Loaded plugin manifest with {} entries", pluginManifest.size());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARN("Failed to read plugin manifest, rebuilding: {}", e.what());
+        pluginManifest.clear();
+    }
+}
+
+void PythonManager::SavePluginManifest() const
+{
+    try
+    {
+        std::ofstream manifest(GetManifestPath(), std::ios::trunc);
+        if (!manifest.is_open())
+        {
+            LOG_WARN("Could not write plugin manifest: {}", GetManifestPath());
+            return;
+        }
+
+        for (const auto& [filepath, entry] : pluginManifest)
+        {
+            manifest << entry.filepath << '\t' << entry.mtime << '\t'
+                     << entry.size << '\t' << (entry.lastLoadOk ? '1' : '0') << '\n';
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARN("Failed to save plugin manifest: {}", e.what());
+    }
+}
+
+void PythonManager::UpdateManifestEntry(const std::string& filepath, bool loadOk)
+{
+    ManifestEntry entry;
+    entry.filepath = filepath;
+    entry.lastLoadOk = loadOk;
+    if (!StatPluginFile(filepath, entry.mtime, entry.size))
+    {
+        pluginManifest.erase(filepath);
+        return;
+    }
+    pluginManifest[filepath] = entry;
+}
+
+bool PythonManager::IsPluginUnchanged(const std::string& filepath) const
+{
+    auto it = pluginManifest.find(filepath);
+    if (it == pluginManifest.end())
+    {
+        return false;
+    }
+
+    uint64_t mtime = 0, size = 0;
+    if (!StatPluginFile(filepath, mtime, size))
+    {
+        return false;
+    }
+    return mtime == it->second.mtime && size == it->second.size;
+}
+
+bool PythonManager::StatPluginFile(const std::string& filepath, uint64_t& mtime, uint64_t& size)
+{
+    try
+    {
+        if (!std::filesystem::exists(filepath))
+        {
+            return false;
+        }
+        mtime = static_cast<uint64_t>(
+            std::filesystem::last_write_time(filepath).time_since_epoch().count());
+        size = static_cast<uint64_t>(std::filesystem::file_size(filepath));
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
 bool PythonManager::SetupPythonPaths()
 {
     try
@@ -495,6 +1697,92 @@ bool PythonManager::SetupPythonPaths()
     }
 }
 
+bool PythonManager::SetupBytecodeBundle()
+{
+    // The framework's own modules change rarely, so importing them from
+    // loose .py files pays a stat() storm plus source compilation at every
+    // launch. We keep a zipimport bundle of precompiled bytecode next to
+    // the scripts and rebuild it only when a source is newer. The loose
+    // files stay on sys.path behind the bundle as a development fallback.
+    static const char* kFrameworkModules[] = {
+        "plugin_loader", "sc4_types", "sc4_logger", "sc4_plugin_base", "uv_manager"
+    };
+
+    try
+    {
+        std::string scriptsDir = GetPluginsDirectory();
+        std::filesystem::path bundlePath = std::filesystem::path(scriptsDir) / "sc4_framework.pyz";
+
+        bool stale = !std::filesystem::exists(bundlePath);
+        if (!stale)
+        {
+            auto bundleTime = std::filesystem::last_write_time(bundlePath);
+            for (const char* moduleName : kFrameworkModules)
+            {
+                std::filesystem::path source =
+                    std::filesystem::path(scriptsDir) / (std::string(moduleName) + ".py");
+                if (std::filesystem::exists(source) &&
+                    std::filesystem::last_write_time(source) > bundleTime)
+                {
+                    stale = true;
+                    break;
+                }
+            }
+        }
+
+        if (stale)
+        {
+            LOG_INFO("Rebuilding framework bytecode bundle: {}", bundlePath.string());
+
+            std::vector<std::string> moduleNames(std::begin(kFrameworkModules),
+                                                 std::end(kFrameworkModules));
+            py::dict locals;
+            locals["scripts_dir"] = scriptsDir;
+            locals["bundle_path"] = bundlePath.string();
+            locals["modules"] = py::cast(moduleNames);
+
+            // Compile each framework source and store its bytecode under
+            // <module>.pyc at the archive root, where zipimport finds it.
+            // The .pyc header carries source mtime/size so stale bytecode
+            // is never used if a loose file sneaks past the mtime check.
+            py::exec(R"(
+import importlib.util, marshal, os, zipfile
+
+tmp_path = bundle_path + '.tmp'
+with zipfile.ZipFile(tmp_path, 'w', zipfile.ZIP_STORED) as bundle:
+    for name in modules:
+        source_path = os.path.join(scripts_dir, name + '.py')
+        if not os.path.exists(source_path):
+            continue
+        with open(source_path, 'r', encoding='utf-8') as f:
+            code = compile(f.read(), source_path, 'exec', dont_inherit=True)
+        stat = os.stat(source_path)
+        data = importlib.util.MAGIC_NUMBER
+        data += (0).to_bytes(4, 'little')
+        data += (int(stat.st_mtime) & 0xFFFFFFFF).to_bytes(4, 'little')
+        data += (stat.st_size & 0xFFFFFFFF).to_bytes(4, 'little')
+        data += marshal.dumps(code)
+        bundle.writestr(name + '.pyc', data)
+os.replace(tmp_path, bundle_path)
+)", py::globals(), locals);
+        }
+
+        // Put the bundle ahead of the loose scripts directory so framework
+        // imports resolve against precompiled bytecode first
+        py::module sys = py::module::import("sys");
+        py::list path = sys.attr("path");
+        path.insert(0, bundlePath.string());
+
+        LOG_INFO("Framework bytecode bundle active: {}", bundlePath.string());
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARN("Bytecode bundle setup failed, falling back to loose files: {}", e.what());
+        return false;
+    }
+}
+
 bool PythonManager::SetupPythonEnvironment()
 {
     try
@@ -562,18 +1850,26 @@ bool PythonManager::LoadPlugin(const std::string& filepath)
 {
     try
     {
+        py::gil_scoped_acquire gil;
+
         std::filesystem::path path(filepath);
         std::string pluginName = path.stem().string();
 
-        if (loadedPlugins.find(pluginName) != loadedPlugins.end())
+        if (pluginIndex.find(pluginName) != pluginIndex.end())
         {
             LOG_INFO("Plugin already loaded: {}", pluginName);
             return true;
         }
 
-        // Import the plugin module from examples subdirectory
+        // Import the plugin module from examples subdirectory; attributed
+        // individually in the startup report so a slow import is traceable
+        // to its plugin
         std::string moduleName = "examples." + pluginName;
-        py::module pluginModule = py::module::import(moduleName.c_str());
+        py::module pluginModule;
+        {
+            StartupProfiler::Scope profile("import:" + pluginName);
+            pluginModule = py::module::import(moduleName.c_str());
+        }
         
         // Look for plugin_instance in the module
         if (!py::hasattr(pluginModule, "plugin_instance")) {
@@ -584,21 +1880,39 @@ bool PythonManager::LoadPlugin(const std::string& filepath)
         // Get the plugin class and instantiate it with the city wrapper
         py::object pluginClass = pluginModule.attr("plugin_instance");
         py::object pluginInstance = pluginClass(cityWrapper);
-        
-        // Store the plugin instance
-        py::object* instancePtr = new py::object(pluginInstance);
 
-        PluginInfo info;
-        info.filepath = filepath;
-        info.name = pluginName;
-        info.instance_ptr = instancePtr;
-        info.loaded = true;
+        // One allocation per plugin: instance handle plus the well-known
+        // methods resolved once, so dispatch never pays per-call string
+        // lookups or extra heap indirection
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        auto* runtime = new PluginRuntime();
+        runtime->instance = pluginInstance;
+        runtime->methods.handleCheat = ResolveMethod(pluginInstance, interned->handle_cheat);
+        runtime->methods.handleMessage = ResolveMethod(pluginInstance, interned->handle_message);
+        runtime->methods.onCityInit = ResolveMethod(pluginInstance, interned->on_city_init);
+        runtime->methods.onCityShutdown = ResolveMethod(pluginInstance, interned->on_city_shutdown);
+        runtime->methods.shutdown = ResolveMethod(pluginInstance, interned->shutdown);
+        runtime->methods.getRegisteredCheats = ResolveMethod(pluginInstance, interned->get_registered_cheats);
+
+        PluginSlot& slot = plugins[AcquirePluginSlot(pluginName)];
+        slot.filepath = filepath;
+        slot.runtime_ptr = runtime;
+        slot.loaded = true;
+        slot.statsSlot = PluginStats::RegisterPlugin(pluginName);
 
-        loadedPlugins[pluginName] = info;
+        // Frame-time budget: the plugin's own declaration wins, otherwise
+        // the framework default applies; 0 opts out of enforcement
+        slot.budgetMicros = kDefaultFrameBudgetMicros;
+        slot.overrunStreak = 0;
+        slot.throttlePenalty = 0;
+        if (py::hasattr(pluginInstance, interned->get_frame_budget_us)) {
+            slot.budgetMicros = pluginInstance.attr(interned->get_frame_budget_us)().cast<uint32_t>();
+        }
 
         // Call initialize method on the plugin
-        if (py::hasattr(pluginInstance, "initialize")) {
-            bool initResult = pluginInstance.attr("initialize")().cast<bool>();
+        if (py::hasattr(pluginInstance, interned->initialize)) {
+            StartupProfiler::Scope profile("initialize:" + pluginName);
+            bool initResult = pluginInstance.attr(interned->initialize)().cast<bool>();
             if (!initResult) {
                 LOG_WARN("Plugin {} initialize() returned false", pluginName);
                 UnloadPlugin(pluginName);
@@ -606,6 +1920,10 @@ bool PythonManager::LoadPlugin(const std::string& filepath)
             }
         }
 
+        // Register message subscriptions after initialize() so plugins can
+        // declare handlers they set up during initialization
+        RegisterMessageSubscriptions(pluginName);
+
         LOG_INFO("Successfully loaded plugin: {}", pluginName);
         return true;
     }
@@ -616,23 +1934,119 @@ bool PythonManager::LoadPlugin(const std::string& filepath)
     }
 }
 
-void PythonManager::UnloadPlugin(const std::string& pluginName)
+bool PythonManager::RegisterMessageSubscriptions(const std::string& pluginName)
 {
-    auto it = loadedPlugins.find(pluginName);
-    if (it != loadedPlugins.end())
+    PluginSlot* slot = FindPlugin(pluginName);
+    if (!slot || !slot->runtime_ptr)
     {
-        try
+        return false;
+    }
+
+    try
+    {
+        auto* runtime = static_cast<PluginRuntime*>(slot->runtime_ptr);
+        if (!runtime->methods.handleMessage)
+        {
+            return true; // Nothing to dispatch to
+        }
+
+        auto* interned = static_cast<InternedTable*>(interned_ptr);
+        if (!py::hasattr(runtime->instance, interned->get_subscribed_messages))
+        {
+            LOG_WARN("Plugin {} has handle_message but no get_subscribed_messages(); "
+                     "it will not receive any messages", pluginName);
+            return true;
+        }
+
+        py::object typeList = runtime->instance.attr(interned->get_subscribed_messages)();
+
+        // Message types the plugin allows to run off the game thread
+        std::vector<uint32_t> deferrableTypes;
+        if (py::hasattr(runtime->instance, interned->get_deferrable_messages))
+        {
+            py::object deferrableList = runtime->instance.attr(interned->get_deferrable_messages)();
+            for (auto item : deferrableList)
+            {
+                deferrableTypes.push_back(item.cast<uint32_t>());
+            }
+        }
+
+        size_t subscriptionCount = 0;
+        for (auto item : typeList)
         {
-            CallPluginMethod(pluginName, "shutdown");
+            uint32_t messageType = item.cast<uint32_t>();
+
+            MessageSubscriber subscriber;
+            subscriber.pluginName = pluginName;
+            // Points into the registry-owned runtime block, which outlives
+            // the subscription (cleared before the slot is retired)
+            subscriber.handler_ptr = &runtime->methods.handleMessage;
+            subscriber.deferrable = std::find(deferrableTypes.begin(), deferrableTypes.end(),
+                                              messageType) != deferrableTypes.end();
+            subscriber.statsSlot = slot->statsSlot;
+            subscriber.pluginHandle = static_cast<size_t>(slot - plugins.data());
+            messageSubscribers[messageType].push_back(subscriber);
+            subscriptionCount++;
+        }
+
+        LOG_INFO("Plugin {} subscribed to {} message types", pluginName, subscriptionCount);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Error registering message subscriptions for {}: {}", pluginName, e.what());
+        return false;
+    }
+}
 
-            if (it->second.instance_ptr)
+void PythonManager::ClearMessageSubscriptions(const std::string& pluginName)
+{
+    for (auto it = messageSubscribers.begin(); it != messageSubscribers.end();)
+    {
+        auto& subscribers = it->second;
+        for (auto subIt = subscribers.begin(); subIt != subscribers.end();)
+        {
+            if (subIt->pluginName == pluginName)
+            {
+                // handler_ptr points into the plugin's runtime block; the
+                // registry owns that, so nothing to free here
+                subIt = subscribers.erase(subIt);
+            }
+            else
             {
-                delete static_cast<py::object*>(it->second.instance_ptr);
-                it->second.instance_ptr = nullptr;
+                ++subIt;
             }
+        }
+
+        // Drop empty entries so HandleMessage's early-out stays a single miss
+        if (subscribers.empty())
+        {
+            it = messageSubscribers.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void PythonManager::UnloadPlugin(const std::string& pluginName)
+{
+    PluginSlot* slot = FindPlugin(pluginName);
+    if (slot)
+    {
+        try
+        {
+            CallPluginMethod(*slot, PluginMethod::Shutdown);
+
+            ClearMessageSubscriptions(pluginName);
 
-            it->second.loaded = false;
-            loadedPlugins.erase(it);
+            RetirePluginSlot(*slot);
+
+            // Release the name so the retired slot can be reused; the slot
+            // itself stays in the arena to keep other handles stable
+            pluginIndex.erase(pluginName);
+            slot->name.clear();
             LOG_INFO("Unloaded plugin: {}", pluginName);
         }
         catch (const std::exception& e)
@@ -642,6 +2056,56 @@ void PythonManager::UnloadPlugin(const std::string& pluginName)
     }
 }
 
+PythonManager::PluginSlot* PythonManager::FindPlugin(const std::string& pluginName)
+{
+    auto it = pluginIndex.find(pluginName);
+    return it == pluginIndex.end() ? nullptr : &plugins[it->second];
+}
+
+const PythonManager::PluginSlot* PythonManager::FindPlugin(const std::string& pluginName) const
+{
+    auto it = pluginIndex.find(pluginName);
+    return it == pluginIndex.end() ? nullptr : &plugins[it->second];
+}
+
+size_t PythonManager::AcquirePluginSlot(const std::string& pluginName)
+{
+    // Prefer a retired slot so long sessions with many reload cycles don't
+    // grow the arena unboundedly
+    for (size_t i = 0; i < plugins.size(); i++)
+    {
+        if (!plugins[i].loaded && plugins[i].name.empty())
+        {
+            plugins[i].name = pluginName;
+            pluginIndex[pluginName] = i;
+            return i;
+        }
+    }
+
+    PluginSlot slot;
+    slot.name = pluginName;
+    slot.runtime_ptr = nullptr;
+    slot.loaded = false;
+    slot.statsSlot = -1;
+    slot.budgetMicros = kDefaultFrameBudgetMicros;
+    slot.overrunStreak = 0;
+    slot.throttlePenalty = 0;
+    plugins.push_back(std::move(slot));
+    pluginIndex[pluginName] = plugins.size() - 1;
+    return plugins.size() - 1;
+}
+
+void PythonManager::RetirePluginSlot(PluginSlot& slot)
+{
+    if (slot.runtime_ptr)
+    {
+        py::gil_scoped_acquire gil;
+        delete static_cast<PluginRuntime*>(slot.runtime_ptr);
+        slot.runtime_ptr = nullptr;
+    }
+    slot.loaded = false;
+}
+
 std::map<std::string, std::string> PythonManager::GetRegisteredCheats() const
 {
     std::map<std::string, std::string> registeredCheats;
@@ -651,15 +2115,17 @@ std::map<std::string, std::string> PythonManager::GetRegisteredCheats() const
     }
     
     try {
+        py::gil_scoped_acquire gil;
+
         // Get cheats from all loaded plugins
-        for (const auto& [pluginName, plugin] : loadedPlugins) {
-            if (plugin.loaded && plugin.instance_ptr) {
-                auto* pluginObj = static_cast<py::object*>(plugin.instance_ptr);
-                
+        for (const auto& slot : plugins) {
+            if (slot.loaded && slot.runtime_ptr) {
+                auto& methods = static_cast<PluginRuntime*>(slot.runtime_ptr)->methods;
+
                 // Check if plugin has get_registered_cheats method
-                if (py::hasattr(*pluginObj, "get_registered_cheats")) {
-                    py::object cheatsDict = pluginObj->attr("get_registered_cheats")();
-                    
+                if (methods.getRegisteredCheats) {
+                    py::object cheatsDict = methods.getRegisteredCheats();
+
                     // Convert Python dict to C++ map
                     py::dict cheats = cheatsDict.cast<py::dict>();
                     for (auto item : cheats) {
@@ -686,22 +2152,24 @@ std::vector<PythonManager::CheatInfo> PythonManager::GetRegisteredCheatsWithPlug
     }
     
     try {
+        py::gil_scoped_acquire gil;
+
         // Get cheats from all loaded plugins
-        for (const auto& [pluginName, plugin] : loadedPlugins) {
-            if (plugin.loaded && plugin.instance_ptr) {
-                auto* pluginObj = static_cast<py::object*>(plugin.instance_ptr);
-                
+        for (const auto& slot : plugins) {
+            if (slot.loaded && slot.runtime_ptr) {
+                auto& methods = static_cast<PluginRuntime*>(slot.runtime_ptr)->methods;
+
                 // Check if plugin has get_registered_cheats method
-                if (py::hasattr(*pluginObj, "get_registered_cheats")) {
-                    py::object cheatsDict = pluginObj->attr("get_registered_cheats")();
-                    
+                if (methods.getRegisteredCheats) {
+                    py::object cheatsDict = methods.getRegisteredCheats();
+
                     // Convert Python dict to C++ vector with plugin info
                     py::dict cheats = cheatsDict.cast<py::dict>();
                     for (auto item : cheats) {
                         CheatInfo cheatInfo;
                         cheatInfo.cheatText = item.first.cast<std::string>();
                         cheatInfo.description = item.second.cast<std::string>();
-                        cheatInfo.pluginName = pluginName;
+                        cheatInfo.pluginName = slot.name;
                         cheatsWithPlugin.push_back(cheatInfo);
                     }
                 }
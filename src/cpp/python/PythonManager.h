@@ -7,7 +7,11 @@ namespace py = pybind11;
 using namespace py::literals;
 
 // Standard library includes after pybind11
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -21,6 +25,8 @@ using namespace py::literals;
 #include "cIGZMessage2Standard.h"
 
 // Forward declaration to avoid circular dependency
+class PythonWorkQueue;
+class IsolatedPluginHost;
 
 class PythonManager
 {
@@ -32,14 +38,48 @@ public:
     bool Initialize();
     void Shutdown();
 
+    // Asynchronous initialization: boots the interpreter on a background
+    // thread so it overlaps with SC4's own startup. Call InitializeAsync()
+    // from OnStart() and WaitForInitialization() from PostAppInit().
+    // Handle* calls arriving in between fast-fail natively.
+    bool InitializeAsync();
+    bool WaitForInitialization();
+
     // Plugin management
     bool LoadPlugins();
     void UnloadPlugins();
     bool ReloadPlugins();
 
+    // Incremental hot reload of a single plugin via importlib.reload
+    // semantics. Other plugins keep their instances, cached handles and
+    // registered cheats; only the named module is re-imported and re-bound.
+    bool ReloadPlugin(const std::string& pluginName);
+
     // Message handling
     bool HandleMessage(cIGZMessage2& message);
     bool HandleMessage(uint32_t messageType, cIGZMessage2Standard* pMessage);
+
+    // Applies side effects posted by deferred (off-thread) handlers.
+    // Called by the DllDirector at a safe point on the game thread.
+    void DrainCompletedWork();
+
+    // One hash probe (plus one per isolated host), no logging, no GIL:
+    // does any loaded plugin want this message type? The DllDirector
+    // checks this at the very top of DoMessage so messages nobody
+    // subscribed to cost nothing more. Kept in sync by the subscription
+    // registry on plugin load/unload/reload.
+    bool IsMessageSubscribed(uint32_t messageType) const;
+
+    // Pushes the current city state (POD snapshot) to isolated plugin
+    // hosts; called by the DllDirector once per exec cycle
+    void PublishCityState();
+
+    // Steps the framework-owned asyncio event loop until the given
+    // per-frame budget is spent or nothing is pending. Handlers written as
+    // coroutines (async def handle_message) get scheduled on this loop and
+    // amortize long jobs across frames instead of spiking one. Called by
+    // the DllDirector once per exec cycle.
+    bool PumpAsyncTasks(uint32_t budgetMicros = 1000);
     
     // Cheat handling
     bool HandleCheat(uint32_t cheatID, const std::string& cheatText);
@@ -56,6 +96,10 @@ public:
     // Python environment
     bool IsPythonInitialized() const { return pythonInitialized; }
 
+    // City access - the DllDirector uses this to wire simulation messages
+    // to cache invalidation
+    std::shared_ptr<CityWrapper> GetCityWrapper() const { return cityWrapper; }
+
     // Error handling
     std::string GetLastError() const { return lastError; }
     
@@ -71,23 +115,111 @@ public:
 
 private:
     // Python environment
-    bool pythonInitialized;
+    std::atomic<bool> pythonInitialized;
     std::unique_ptr<py::scoped_interpreter> interpreter;
 
+    // Background initialization bookkeeping. The init thread creates the
+    // interpreter, and CPython/pybind11 require finalization on the
+    // creating thread - so after Initialize() it parks on initCv until
+    // Shutdown() posts finalization to it (see FinalizePython()).
+    enum class InitState { NotStarted, InProgress, Succeeded, Failed };
+    std::atomic<InitState> initState;
+    std::thread initThread;
+    std::mutex initMutex;
+    std::condition_variable initCv;
+    bool finalizeRequested = false;
+
+    // Plugin teardown and interpreter finalization; must run on the
+    // thread that created the interpreter
+    void FinalizePython();
+
     // CRITICAL: NO py::object members in header! 
     // Python objects can only exist AFTER interpreter is initialized.
     // We'll create these dynamically in Initialize() and destroy in Shutdown().
 
-    // Plugin management - using pointers to avoid Python object members
-    struct PluginInfo
+    // Well-known plugin methods whose bound handles are resolved once at
+    // LoadPlugin() time and cached in PluginMethodCache (see the .cpp), so
+    // dispatch never pays per-call hasattr/attr string lookups.
+    enum class PluginMethod
+    {
+        HandleCheat,
+        HandleMessage,
+        OnCityInit,
+        OnCityShutdown,
+        Shutdown,
+        GetRegisteredCheats
+    };
+
+    // Plugin registry: a dense arena of typed slots. A plugin's index in
+    // the vector is its stable handle - slots are retired in place on
+    // unload and reused by the next load, so handles held elsewhere (the
+    // subscription registry, stats) never dangle. Broadcast paths iterate
+    // the contiguous array instead of chasing an unordered_map.
+    struct PluginSlot
     {
         std::string filepath;
         std::string name;
-        void* instance_ptr;  // Will cast to py::object* when needed
-        bool loaded;
+        void* runtime_ptr;   // PluginRuntime* (see .cpp): the py::object
+                             // instance plus the bound-method cache in one
+                             // allocation, created/destroyed under the GIL
+        bool loaded;         // False for retired slots awaiting reuse
+        int statsSlot;       // PluginStats slot for dispatch timing
+
+        // Time-budget scheduler state. A handler call that runs longer than
+        // budgetMicros counts as an overrun; enough consecutive overruns
+        // demote the plugin, skipping its next throttlePenalty inline
+        // handler calls. Bookkeeping rides on the timestamps the dispatch
+        // timer already takes.
+        uint32_t budgetMicros;    // Per-call budget; 0 disables enforcement
+        uint32_t overrunStreak;   // Consecutive over-budget calls
+        uint32_t throttlePenalty; // Inline calls left to skip while demoted
     };
-    
-    std::unordered_map<std::string, PluginInfo> loadedPlugins;
+
+    std::vector<PluginSlot> plugins;
+    std::unordered_map<std::string, size_t> pluginIndex;  // name -> handle
+
+    // Per-message-type subscription registry. Populated at LoadPlugin() time
+    // from the plugin's get_subscribed_messages() declaration so that
+    // HandleMessage can early-out in pure C++ for message types nobody wants.
+    struct MessageSubscriber
+    {
+        std::string pluginName;
+        void* handler_ptr;  // Will cast to py::object* (bound handle_message)
+        bool deferrable;    // Handler may run on the worker thread
+        int statsSlot;      // PluginStats slot of the owning plugin
+        size_t pluginHandle; // Arena index of the owning plugin, for the
+                             // budget scheduler (slots never move)
+    };
+    std::unordered_map<uint32_t, std::vector<MessageSubscriber>> messageSubscribers;
+
+    // Plugin discovery manifest cache. Persisted beside the PythonScripts
+    // directory so startup can skip re-importing plugins whose last load
+    // failed and ReloadPlugins() can compute the changed set in one pass
+    // instead of re-importing every unchanged module.
+    struct ManifestEntry
+    {
+        std::string filepath;
+        uint64_t mtime;
+        uint64_t size;
+        bool lastLoadOk;
+    };
+    std::unordered_map<std::string, ManifestEntry> pluginManifest;  // keyed by filepath
+
+    // Plugins tagged "# sc4-isolated" run in their own sub-interpreters
+    // (own GIL, own worker thread) and never touch the registry above;
+    // they communicate through POD messages and published snapshots only
+    std::vector<std::unique_ptr<IsolatedPluginHost>> isolatedHosts;
+
+    // Worker thread for handlers plugins mark as deferrable. The game
+    // thread releases the GIL when idle (see end of Initialize()) so the
+    // worker can acquire it per task.
+    std::unique_ptr<PythonWorkQueue> workQueue;
+    PyThreadState* mainThreadState;  // GIL state released at end of Initialize()
+
+    // Interned py::str table and pre-resolved sc4_types callables (see
+    // InternedTable in the .cpp). Created right after interpreter init and
+    // freed before finalization, per the no-py-object-members rule above.
+    void* interned_ptr;
     std::shared_ptr<CityWrapper> cityWrapper;
 
     // Cheat ID tracking
@@ -100,6 +232,7 @@ private:
     // Internal methods
     bool InitializePythonEnvironment();
     bool SetupPythonPaths();
+    bool SetupBytecodeBundle();
     bool SetupPythonEnvironment();
     bool LoadPythonBootstrap();
     bool SetupPythonLogging();
@@ -107,11 +240,50 @@ private:
 
     bool LoadPlugin(const std::string& filepath);
     void UnloadPlugin(const std::string& pluginName);
+
+    // Isolation mode ("# sc4-isolated" header tag, scanned natively like
+    // the dependency declarations)
+    static bool IsIsolatedPlugin(const std::string& filepath);
+    bool StartIsolatedPlugin(const std::string& filepath);
+
+    // Dependency-aware load ordering. Plugins declare load-order
+    // dependencies in a "# sc4-requires: other_plugin" header comment,
+    // scanned natively (no GIL, no import) and resolved topologically.
+    std::vector<std::string> SortPluginsByDependencies(const std::vector<std::string>& files) const;
+    static std::vector<std::string> ParseDeclaredDependencies(const std::string& filepath);
+
+    // Compiles plugin sources to bytecode during Initialize() - on the
+    // background thread when InitializeAsync() is used - so the GIL-bound
+    // import loop in LoadPlugins() only unmarshals warm .pyc files
+    bool PrecompilePluginSources();
+
+    // Registry helpers
+    PluginSlot* FindPlugin(const std::string& pluginName);
+    const PluginSlot* FindPlugin(const std::string& pluginName) const;
+    size_t AcquirePluginSlot(const std::string& pluginName);
+    void RetirePluginSlot(PluginSlot& slot);  // Frees the runtime; GIL held
+
+    // Subscription registry maintenance
+    bool RegisterMessageSubscriptions(const std::string& pluginName);
+    void ClearMessageSubscriptions(const std::string& pluginName);
+
+    // Manifest cache maintenance
+    std::string GetManifestPath() const;
+    void LoadPluginManifest();
+    void SavePluginManifest() const;
+    void UpdateManifestEntry(const std::string& filepath, bool loadOk);
+    bool IsPluginUnchanged(const std::string& filepath) const;
+    static bool StatPluginFile(const std::string& filepath, uint64_t& mtime, uint64_t& size);
+
+    // Deferred dispatch
+    void EnqueueDeferredMessage(const MessageSubscriber& subscriber, uint32_t messageType,
+                                uint32_t data1, uint32_t data2, uint32_t data3);
     
     void SetError(const std::string& error) const;
     void LogMessage(const std::string& message, int level = 0) const;
 
     // Python callback handlers - no py::args in header!
-    bool CallPluginMethod(const std::string& pluginName, const std::string& method);
-    bool CallAllPlugins(const std::string& method);
+    bool CallPluginMethod(const std::string& pluginName, PluginMethod method);
+    bool CallPluginMethod(PluginSlot& slot, PluginMethod method);
+    bool CallAllPlugins(PluginMethod method);
 };
\ No newline at end of file
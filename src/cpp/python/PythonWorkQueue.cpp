@@ -0,0 +1,175 @@
+// pybind11 includes MUST be first - included via PythonWorkQueue.h
+#include "PythonWorkQueue.h"
+
+// Other includes after pybind11
+#include "../utils/Logger.h"
+
+
+PythonWorkQueue::PythonWorkQueue()
+    : incoming(nullptr)
+    , pendingCount(0)
+    , running(false)
+{
+}
+
+PythonWorkQueue::~PythonWorkQueue()
+{
+    Stop();
+}
+
+void PythonWorkQueue::Start()
+{
+    if (running.exchange(true))
+    {
+        return;
+    }
+
+    worker = std::thread(&PythonWorkQueue::WorkerLoop, this);
+    LOG_INFO("Python work queue started");
+}
+
+void PythonWorkQueue::Stop()
+{
+    if (!running.exchange(false))
+    {
+        return;
+    }
+
+    wakeCondition.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+
+    // Drop any tasks that never ran; their plugins are going away anyway
+    Node* node = TakeAll();
+    size_t dropped = 0;
+    while (node)
+    {
+        Node* next = node->next;
+        delete node;
+        node = next;
+        dropped++;
+    }
+    if (dropped > 0)
+    {
+        LOG_WARN("Python work queue stopped with {} pending tasks dropped", dropped);
+    }
+    pendingCount.store(0, std::memory_order_relaxed);
+
+    LOG_INFO("Python work queue stopped");
+}
+
+void PythonWorkQueue::Enqueue(Task task)
+{
+    auto* node = new Node{ std::move(task), nullptr };
+
+    // Lock-free push onto the incoming stack
+    node->next = incoming.load(std::memory_order_relaxed);
+    while (!incoming.compare_exchange_weak(node->next, node,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed))
+    {
+    }
+
+    pendingCount.fetch_add(1, std::memory_order_relaxed);
+    wakeCondition.notify_one();
+}
+
+void PythonWorkQueue::PostCompletion(Task task)
+{
+    std::lock_guard<std::mutex> lock(completionMutex);
+    completions.push_back(std::move(task));
+}
+
+void PythonWorkQueue::DrainCompletions()
+{
+    std::vector<Task> pending;
+    {
+        std::lock_guard<std::mutex> lock(completionMutex);
+        if (completions.empty())
+        {
+            return;
+        }
+        pending.swap(completions);
+    }
+
+    for (auto& task : pending)
+    {
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Error applying deferred completion: {}", e.what());
+        }
+    }
+}
+
+void PythonWorkQueue::WaitForIdle()
+{
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    idleCondition.wait(lock, [this] {
+        return pendingCount.load(std::memory_order_acquire) == 0;
+    });
+}
+
+PythonWorkQueue::Node* PythonWorkQueue::TakeAll()
+{
+    Node* chain = incoming.exchange(nullptr, std::memory_order_acquire);
+
+    // The stack is LIFO; reverse it so tasks run in enqueue order
+    Node* reversed = nullptr;
+    while (chain)
+    {
+        Node* next = chain->next;
+        chain->next = reversed;
+        reversed = chain;
+        chain = next;
+    }
+    return reversed;
+}
+
+void PythonWorkQueue::WorkerLoop()
+{
+    LOG_DEBUG("Python work queue worker thread running");
+
+    while (running.load(std::memory_order_relaxed))
+    {
+        Node* node = TakeAll();
+        if (!node)
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait(lock, [this] {
+                return !running.load(std::memory_order_relaxed) ||
+                       incoming.load(std::memory_order_relaxed) != nullptr;
+            });
+            continue;
+        }
+
+        while (node)
+        {
+            try
+            {
+                node->task();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Error in deferred plugin task: {}", e.what());
+            }
+
+            Node* next = node->next;
+            delete node;
+            node = next;
+
+            if (pendingCount.fetch_sub(1, std::memory_order_release) == 1)
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                idleCondition.notify_all();
+            }
+        }
+    }
+
+    LOG_DEBUG("Python work queue worker thread exiting");
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+// pybind11 includes MUST be first
+#include <pybind11/embed.h>
+#include <pybind11/pybind11.h>
+namespace py = pybind11;
+
+// Standard library includes after pybind11
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Off-main-thread execution of deferrable plugin work.
+//
+// Producers (the game thread) pay only a lock-free MPSC enqueue; a single
+// worker thread drains the queue and acquires the GIL per task via
+// py::gil_scoped_acquire. Tasks that need to apply side effects on the game
+// thread post them back with PostCompletion(); the game thread runs those
+// at a safe point by calling DrainCompletions().
+//
+// Requires the main thread to have released the GIL while idle
+// (PythonManager does this at the end of Initialize()).
+class PythonWorkQueue
+{
+public:
+    using Task = std::function<void()>;
+
+    PythonWorkQueue();
+    ~PythonWorkQueue();
+
+    void Start();
+    void Stop();
+
+    // Lock-free multi-producer enqueue; safe from the game thread while the
+    // worker is draining. The task runs on the worker thread and must
+    // acquire the GIL itself if it touches Python.
+    void Enqueue(Task task);
+
+    // Called from worker tasks to marshal side effects back to the game thread
+    void PostCompletion(Task task);
+
+    // Called on the game thread at a safe point; runs pending completions
+    void DrainCompletions();
+
+    // Blocks until every enqueued task has finished executing. Must be
+    // called WITHOUT the GIL held - in-flight tasks need it to finish.
+    void WaitForIdle();
+
+    size_t GetPendingCount() const { return pendingCount.load(std::memory_order_relaxed); }
+
+private:
+    struct Node
+    {
+        Task task;
+        Node* next;
+    };
+
+    // MPSC stack: producers push with an atomic exchange, the worker takes
+    // the whole chain in one exchange and reverses it to restore FIFO order
+    std::atomic<Node*> incoming;
+    std::atomic<size_t> pendingCount;
+
+    // Completions are low frequency, so a mutex-guarded vector is sufficient
+    std::mutex completionMutex;
+    std::vector<Task> completions;
+
+    std::thread worker;
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable idleCondition;
+
+    void WorkerLoop();
+    Node* TakeAll();
+};
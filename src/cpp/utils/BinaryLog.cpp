@@ -0,0 +1,155 @@
+#include "BinaryLog.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+#include <windows.h>
+
+namespace
+{
+    std::mutex s_fileMutex;
+    FILE* s_file = nullptr;
+
+    // Format table: index + 1 is the ID on the wire. Only touched at
+    // call-site registration (once per site), never per record.
+    std::mutex s_formatMutex;
+    std::vector<std::string> s_formats;
+
+    int64_t QpcFrequency()
+    {
+        static int64_t frequency = []() {
+            LARGE_INTEGER freq;
+            QueryPerformanceFrequency(&freq);
+            return freq.QuadPart;
+        }();
+        return frequency;
+    }
+}
+
+std::atomic<bool> BinaryLog::s_enabled{false};
+
+BinaryLog::ThreadBuffer::~ThreadBuffer()
+{
+    FlushBuffer(*this);
+}
+
+BinaryLog::ThreadBuffer& BinaryLog::GetThreadBuffer()
+{
+    thread_local ThreadBuffer buffer;
+    return buffer;
+}
+
+bool BinaryLog::Initialize(const std::string& directory)
+{
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (s_file)
+    {
+        return true;
+    }
+
+    std::filesystem::path path = std::filesystem::path(directory) / "SC4PythonFramework.blog";
+    s_file = fopen(path.string().c_str(), "wb");
+    if (!s_file)
+    {
+        return false;
+    }
+
+    // Header: magic, version, tick frequency and wall-clock anchor so the
+    // decoder can map QPC ticks to absolute timestamps
+    fwrite("S4BL", 1, 4, s_file);
+    uint32_t version = kVersion;
+    fwrite(&version, sizeof(version), 1, s_file);
+    uint64_t frequency = static_cast<uint64_t>(QpcFrequency());
+    fwrite(&frequency, sizeof(frequency), 1, s_file);
+    uint64_t epochMs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    fwrite(&epochMs, sizeof(epochMs), 1, s_file);
+
+    s_enabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void BinaryLog::Shutdown()
+{
+    // Stop producers first so late records hit the enabled check, then
+    // drain this thread and close. Other threads' tails drain through
+    // their buffer destructors, which no-op once the file is gone.
+    s_enabled.store(false, std::memory_order_release);
+    FlushThread();
+
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (s_file)
+    {
+        fclose(s_file);
+        s_file = nullptr;
+    }
+}
+
+uint16_t BinaryLog::RegisterFormat(const char* format)
+{
+    std::lock_guard<std::mutex> lock(s_formatMutex);
+
+    s_formats.push_back(format ? format : "");
+    uint16_t id = static_cast<uint16_t>(s_formats.size());
+
+    // Emit the definition inline so the decoder always sees it before the
+    // first event that references it
+    if (IsEnabled())
+    {
+        const std::string& text = s_formats.back();
+        uint16_t length = static_cast<uint16_t>(
+            text.size() > UINT16_MAX ? UINT16_MAX : text.size());
+
+        ThreadBuffer& buffer = GetThreadBuffer();
+        if (Reserve(buffer, 1 + sizeof(id) + sizeof(length) + length))
+        {
+            AppendByte(buffer, 2);  // kind: format definition
+            AppendRaw(buffer, &id, sizeof(id));
+            AppendRaw(buffer, &length, sizeof(length));
+            AppendRaw(buffer, text.data(), length);
+        }
+    }
+    return id;
+}
+
+void BinaryLog::FlushThread()
+{
+    FlushBuffer(GetThreadBuffer());
+}
+
+bool BinaryLog::Reserve(ThreadBuffer& buffer, size_t bytes)
+{
+    if (bytes > kThreadBufferSize)
+    {
+        return false;  // Oversized record; drop rather than split
+    }
+    if (buffer.used + bytes > kThreadBufferSize)
+    {
+        FlushBuffer(buffer);
+    }
+    return true;
+}
+
+void BinaryLog::FlushBuffer(ThreadBuffer& buffer)
+{
+    if (buffer.used == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_fileMutex);
+    if (s_file)
+    {
+        fwrite(buffer.data, 1, buffer.used, s_file);
+    }
+    buffer.used = 0;
+}
+
+uint64_t BinaryLog::NowTicks()
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return static_cast<uint64_t>(now.QuadPart);
+}
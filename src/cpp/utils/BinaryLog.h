@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// Deferred-formatting binary trace log. The async logger still pays
+// fmt::format on the calling thread for every record; for dispatch-rate
+// DEBUG tracing that cost dominates. A binary record instead stores a
+// static format-string ID plus the raw argument values into a per-thread
+// buffer - tens of nanoseconds - and formatting happens offline in the
+// companion decoder (tools/decode_binary_log.py), which replays the
+// format table embedded in the file.
+//
+// Opt-in: Logger::Initialize() enables this when the SC4PY_BINARY_LOG
+// environment variable is set, writing SC4PythonFramework.blog next to
+// the text log. WARN and above always go through the human-readable
+// sinks regardless - this sink only ever replaces DEBUG-level tracing.
+//
+// File format (little-endian):
+//   header:  "S4BL", u32 version, u64 qpc frequency, u64 unix epoch ms
+//   records: u8 kind
+//     kind 1 (event):  u16 format id, u64 qpc ticks, u8 argc,
+//                      argc x { u8 tag (0=u64, 1=str), u64 | u8 len + bytes }
+//     kind 2 (format): u16 format id, u16 len, bytes (fmt-style string)
+// Format-definition records appear before the first event that uses them.
+class BinaryLog
+{
+public:
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kThreadBufferSize = 16 * 1024;
+    static constexpr size_t kMaxStringLength = 255;
+
+    // Opens the trace file and writes the header; failure leaves the
+    // facility disabled and every Record() a single load-and-branch
+    static bool Initialize(const std::string& directory);
+    static void Shutdown();
+
+    static bool IsEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Interns a static format string, emitting its definition record once.
+    // Meant to be called through a function-local static so each call site
+    // pays the registration exactly once (see LOG_DEBUG_BIN).
+    static uint16_t RegisterFormat(const char* format);
+
+    // Drains the calling thread's buffer to disk; buffers also drain when
+    // full and when their thread exits
+    static void FlushThread();
+
+    template <typename... Args>
+    static void Record(uint16_t formatId, Args&&... args)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        // Worst case size keeps the reserve check trivial: header plus
+        // 9 bytes per integer arg or tag+len+payload per string
+        ThreadBuffer& buffer = GetThreadBuffer();
+        if (!Reserve(buffer, kRecordHeaderSize + TotalArgSize(args...)))
+        {
+            return;
+        }
+
+        AppendByte(buffer, 1);  // kind: event
+        AppendRaw(buffer, &formatId, sizeof(formatId));
+        uint64_t ticks = NowTicks();
+        AppendRaw(buffer, &ticks, sizeof(ticks));
+        AppendByte(buffer, static_cast<uint8_t>(sizeof...(Args)));
+        (AppendArg(buffer, std::forward<Args>(args)), ...);
+    }
+
+private:
+    struct ThreadBuffer
+    {
+        uint8_t data[kThreadBufferSize];
+        size_t used = 0;
+
+        ~ThreadBuffer();  // Drains the tail when the thread exits
+    };
+
+    static constexpr size_t kRecordHeaderSize = 1 + 2 + 8 + 1;
+
+    static ThreadBuffer& GetThreadBuffer();
+    static bool Reserve(ThreadBuffer& buffer, size_t bytes);
+    static void FlushBuffer(ThreadBuffer& buffer);
+    static uint64_t NowTicks();
+
+    static void AppendByte(ThreadBuffer& buffer, uint8_t value)
+    {
+        buffer.data[buffer.used++] = value;
+    }
+
+    static void AppendRaw(ThreadBuffer& buffer, const void* bytes, size_t count)
+    {
+        memcpy(buffer.data + buffer.used, bytes, count);
+        buffer.used += count;
+    }
+
+    template <typename T, typename std::enable_if<std::is_integral<typename std::decay<T>::type>::value ||
+                                                  std::is_enum<typename std::decay<T>::type>::value, int>::type = 0>
+    static void AppendArg(ThreadBuffer& buffer, T value)
+    {
+        AppendByte(buffer, 0);  // tag: u64
+        uint64_t widened = static_cast<uint64_t>(value);
+        AppendRaw(buffer, &widened, sizeof(widened));
+    }
+
+    static void AppendArg(ThreadBuffer& buffer, const char* value)
+    {
+        AppendString(buffer, value, value ? strlen(value) : 0);
+    }
+
+    static void AppendArg(ThreadBuffer& buffer, const std::string& value)
+    {
+        AppendString(buffer, value.data(), value.size());
+    }
+
+    static void AppendString(ThreadBuffer& buffer, const char* bytes, size_t length)
+    {
+        if (length > kMaxStringLength)
+        {
+            length = kMaxStringLength;
+        }
+        AppendByte(buffer, 1);  // tag: str
+        AppendByte(buffer, static_cast<uint8_t>(length));
+        AppendRaw(buffer, bytes, length);
+    }
+
+    template <typename T, typename std::enable_if<std::is_integral<typename std::decay<T>::type>::value ||
+                                                  std::is_enum<typename std::decay<T>::type>::value, int>::type = 0>
+    static size_t ArgSize(const T&) { return 1 + 8; }
+    static size_t ArgSize(const char* value) { return 2 + (value ? strlen(value) : 0); }
+    static size_t ArgSize(const std::string& value) { return 2 + value.size(); }
+
+    static size_t TotalArgSize() { return 0; }
+    template <typename First, typename... Rest>
+    static size_t TotalArgSize(const First& first, const Rest&... rest)
+    {
+        return ArgSize(first) + TotalArgSize(rest...);
+    }
+
+    static std::atomic<bool> s_enabled;
+
+    BinaryLog() = default;
+};
@@ -1,7 +1,16 @@
 #include "Logger.h"
+#include "BinaryLog.h"
 #include <filesystem>
 #include <cstdlib>
 
+namespace
+{
+    // Async ring buffer: preallocated once, sized for bursts of DEBUG
+    // dispatch tracing without producers ever touching the disk
+    constexpr size_t kAsyncQueueSize = 8192;
+    constexpr int kFlushIntervalSeconds = 3;
+}
+
 std::shared_ptr<spdlog::logger> Logger::s_logger = nullptr;
 bool Logger::s_initialized = false;
 
@@ -14,7 +23,7 @@ std::shared_ptr<spdlog::logger> Logger::Get()
     return s_logger;
 }
 
-void Logger::Initialize()
+void Logger::Initialize(OverflowPolicy policy)
 {
     if (s_initialized && s_logger)
     {
@@ -26,26 +35,49 @@ void Logger::Initialize()
         // Create multiple sinks: console (MSVC debug output) and file
         std::vector<spdlog::sink_ptr> sinks;
         sinks.push_back(std::make_shared<spdlog::sinks::msvc_sink_mt>());
-        
+
         // Add file sink - write to user's Documents folder where SC4 can find it
         std::string userProfile = std::getenv("USERPROFILE") ? std::getenv("USERPROFILE") : "";
         if (!userProfile.empty())
         {
             std::filesystem::path logDir = std::filesystem::path(userProfile) / "Documents" / "SimCity 4";
             std::filesystem::create_directories(logDir);
-            
+
             std::string logPath = (logDir / "SC4PythonFramework.log").string();
             sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(logPath, false));
+
+            // Opt-in binary trace sink with deferred formatting; the text
+            // sinks above keep carrying WARN and above regardless
+            if (std::getenv("SC4PY_BINARY_LOG"))
+            {
+                BinaryLog::Initialize(logDir.string());
+            }
         }
-        
-        s_logger = std::make_shared<spdlog::logger>("SC4PythonFramework", sinks.begin(), sinks.end());
+
+        // Asynchronous logger: log calls enqueue into a bounded ring buffer
+        // and a single background thread formats to the sinks. The old
+        // flush_on(debug) forced a file sync on every message - in the
+        // middle of gameplay input handling. Now only WARN and above flush
+        // immediately; everything else is flushed periodically.
+        spdlog::init_thread_pool(kAsyncQueueSize, 1);
+        auto overflowPolicy = (policy == OverflowPolicy::Block)
+            ? spdlog::async_overflow_policy::block
+            : spdlog::async_overflow_policy::overrun_oldest;
+
+        s_logger = std::make_shared<spdlog::async_logger>(
+            "SC4PythonFramework", sinks.begin(), sinks.end(),
+            spdlog::thread_pool(), overflowPolicy);
+        spdlog::register_logger(s_logger);
+
         s_logger->set_level(spdlog::level::debug);
         s_logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%n] [%l] %v");
-        s_logger->flush_on(spdlog::level::debug); // Flush on every log message
-        
+        s_logger->flush_on(spdlog::level::warn);
+        spdlog::flush_every(std::chrono::seconds(kFlushIntervalSeconds));
+
         s_initialized = true;
-        
-        s_logger->info("SC4PythonFramework logger initialized");
+
+        s_logger->info("SC4PythonFramework logger initialized (async, {} policy)",
+                       policy == OverflowPolicy::Block ? "block" : "drop-oldest");
         if (!userProfile.empty())
         {
             std::filesystem::path logDir = std::filesystem::path(userProfile) / "Documents" / "SimCity 4";
@@ -55,7 +87,7 @@ void Logger::Initialize()
     }
     catch (const std::exception& e)
     {
-        // Fallback to console-only logging if file creation fails
+        // Fallback to synchronous console-only logging if setup fails
         auto consoleSink = std::make_shared<spdlog::sinks::msvc_sink_mt>();
         s_logger = std::make_shared<spdlog::logger>("SC4PythonFramework", consoleSink);
         s_logger->set_level(spdlog::level::debug);
@@ -66,6 +98,7 @@ void Logger::Initialize()
 
 void Logger::Shutdown()
 {
+    BinaryLog::Shutdown();
     if (s_logger)
     {
         s_logger->info("SC4PythonFramework logger shutting down");
@@ -73,4 +106,15 @@ void Logger::Shutdown()
         s_logger.reset();
     }
     s_initialized = false;
-}
\ No newline at end of file
+    // Joins the flush thread and drains anything still queued
+    spdlog::shutdown();
+}
+
+void Logger::FlushNow()
+{
+    if (s_logger)
+    {
+        s_logger->flush();
+    }
+    BinaryLog::FlushThread();
+}
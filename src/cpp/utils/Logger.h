@@ -1,6 +1,7 @@
 #pragma once
 
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/msvc_sink.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <memory>
@@ -9,19 +10,32 @@
 class Logger
 {
 public:
+    // Overflow behavior when the async ring buffer fills up
+    enum class OverflowPolicy
+    {
+        Block,      // Producers wait for space - nothing lost, may stall
+        DropOldest  // Oldest queued messages overwritten - never stalls
+    };
+
     // Get the singleton instance
     static std::shared_ptr<spdlog::logger> Get();
-    
-    // Initialize the logger (called once at startup)
-    static void Initialize();
-    
+
+    // Initialize the logger (called once at startup). Logging is
+    // asynchronous: a call costs a formatted enqueue into a preallocated
+    // ring buffer; a dedicated thread writes and periodically flushes.
+    static void Initialize(OverflowPolicy policy = OverflowPolicy::DropOldest);
+
     // Shutdown the logger (called at exit)
     static void Shutdown();
 
+    // Synchronously drain and flush everything queued. For crash/error
+    // paths that must not lose the trailing messages.
+    static void FlushNow();
+
 private:
     static std::shared_ptr<spdlog::logger> s_logger;
     static bool s_initialized;
-    
+
     Logger() = default;
     ~Logger() = default;
     Logger(const Logger&) = delete;
@@ -34,4 +48,20 @@ private:
 #define LOG_INFO(...) Logger::Get()->info(__VA_ARGS__)
 #define LOG_WARN(...) Logger::Get()->warn(__VA_ARGS__)
 #define LOG_ERROR(...) Logger::Get()->error(__VA_ARGS__)
-#define LOG_CRITICAL(...) Logger::Get()->critical(__VA_ARGS__)
\ No newline at end of file
+#define LOG_CRITICAL(...) Logger::Get()->critical(__VA_ARGS__)
+
+// Dispatch-rate debug tracing: with the binary log enabled (set
+// SC4PY_BINARY_LOG) this records a format ID plus raw argument values -
+// no fmt::format on the calling thread; otherwise it falls back to the
+// regular async debug sink. The format string must be a literal. WARN
+// and above always use the human-readable macros above.
+#include "BinaryLog.h"
+#define LOG_DEBUG_BIN(fmt, ...)                                              \
+    do {                                                                     \
+        if (BinaryLog::IsEnabled()) {                                        \
+            static const uint16_t _blog_id = BinaryLog::RegisterFormat(fmt); \
+            BinaryLog::Record(_blog_id, ##__VA_ARGS__);                      \
+        } else {                                                             \
+            LOG_DEBUG(fmt, ##__VA_ARGS__);                                   \
+        }                                                                    \
+    } while (0)
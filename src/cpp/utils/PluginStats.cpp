@@ -0,0 +1,269 @@
+#include "PluginStats.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <windows.h>
+
+namespace
+{
+    constexpr size_t kMethodCount = static_cast<size_t>(PluginStats::Method::Count);
+    constexpr size_t kMaxNameLength = 63;
+
+    // One fixed-size slot per plugin. Counters are relaxed atomics: the game
+    // thread and the worker thread both record, and the occasional torn
+    // snapshot read only affects a diagnostics report.
+    struct MethodCounters
+    {
+        std::atomic<uint64_t> callCount{0};
+        std::atomic<uint64_t> totalMicros{0};
+        std::atomic<uint64_t> maxMicros{0};
+        std::atomic<uint32_t> buckets[PluginStats::kBucketCount]{};
+    };
+
+    struct Slot
+    {
+        char name[kMaxNameLength + 1] = {};
+        MethodCounters methods[kMethodCount];
+        std::atomic<uint64_t> budgetOverruns{0};
+    };
+
+    Slot s_slots[PluginStats::kMaxPlugins];
+    std::atomic<size_t> s_slotCount{0};
+    std::mutex s_registrationMutex;
+
+    int64_t QpcFrequency()
+    {
+        static int64_t frequency = []() {
+            LARGE_INTEGER freq;
+            QueryPerformanceFrequency(&freq);
+            return freq.QuadPart;
+        }();
+        return frequency;
+    }
+
+    int64_t QpcNow()
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        return now.QuadPart;
+    }
+
+    size_t BucketIndex(uint64_t micros)
+    {
+        size_t index = 0;
+        while (index + 1 < PluginStats::kBucketCount && (micros >> (index + 1)) != 0)
+        {
+            index++;
+        }
+        return index;
+    }
+}
+
+int PluginStats::RegisterPlugin(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_registrationMutex);
+
+    // Reloaded plugins keep their slot so timings accumulate per session
+    size_t count = s_slotCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (name == s_slots[i].name)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    if (count >= kMaxPlugins)
+    {
+        return -1;
+    }
+
+    strncpy(s_slots[count].name, name.c_str(), kMaxNameLength);
+    s_slotCount.store(count + 1, std::memory_order_release);
+    return static_cast<int>(count);
+}
+
+void PluginStats::Record(int slot, Method method, uint64_t micros)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= kMaxPlugins)
+    {
+        return;
+    }
+
+    auto& counters = s_slots[slot].methods[static_cast<size_t>(method)];
+    counters.callCount.fetch_add(1, std::memory_order_relaxed);
+    counters.totalMicros.fetch_add(micros, std::memory_order_relaxed);
+    counters.buckets[BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t observedMax = counters.maxMicros.load(std::memory_order_relaxed);
+    while (micros > observedMax &&
+           !counters.maxMicros.compare_exchange_weak(observedMax, micros,
+                                                     std::memory_order_relaxed))
+    {
+    }
+}
+
+void PluginStats::RecordOverrun(int slot)
+{
+    if (slot < 0 || static_cast<size_t>(slot) >= kMaxPlugins)
+    {
+        return;
+    }
+    s_slots[slot].budgetOverruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<PluginStats::PluginSnapshot> PluginStats::Snapshot()
+{
+    std::vector<PluginSnapshot> snapshots;
+    size_t count = s_slotCount.load(std::memory_order_acquire);
+    snapshots.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        PluginSnapshot snapshot;
+        snapshot.pluginName = s_slots[i].name;
+        snapshot.budgetOverruns = s_slots[i].budgetOverruns.load(std::memory_order_relaxed);
+        for (size_t m = 0; m < kMethodCount; m++)
+        {
+            const auto& counters = s_slots[i].methods[m];
+            auto& dest = snapshot.methods[m];
+            dest.callCount = counters.callCount.load(std::memory_order_relaxed);
+            dest.totalMicros = counters.totalMicros.load(std::memory_order_relaxed);
+            dest.maxMicros = counters.maxMicros.load(std::memory_order_relaxed);
+            for (size_t b = 0; b < kBucketCount; b++)
+            {
+                dest.buckets[b] = counters.buckets[b].load(std::memory_order_relaxed);
+            }
+        }
+        snapshots.push_back(std::move(snapshot));
+    }
+    return snapshots;
+}
+
+void PluginStats::Reset()
+{
+    size_t count = s_slotCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t m = 0; m < kMethodCount; m++)
+        {
+            auto& counters = s_slots[i].methods[m];
+            counters.callCount.store(0, std::memory_order_relaxed);
+            counters.totalMicros.store(0, std::memory_order_relaxed);
+            counters.maxMicros.store(0, std::memory_order_relaxed);
+            for (size_t b = 0; b < kBucketCount; b++)
+            {
+                counters.buckets[b].store(0, std::memory_order_relaxed);
+            }
+        }
+        s_slots[i].budgetOverruns.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t PluginStats::PercentileMicros(const MethodStats& stats, double percentile)
+{
+    if (stats.callCount == 0)
+    {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(percentile * static_cast<double>(stats.callCount));
+    if (target == 0)
+    {
+        target = 1;
+    }
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        cumulative += stats.buckets[i];
+        if (cumulative >= target)
+        {
+            // Upper bound of the bucket: [2^i, 2^(i+1)) us
+            return static_cast<uint64_t>(1) << (i + 1);
+        }
+    }
+    return stats.maxMicros;
+}
+
+const char* PluginStats::MethodName(Method method)
+{
+    switch (method)
+    {
+        case Method::HandleMessage: return "handle_message";
+        case Method::HandleCheat:   return "handle_cheat";
+        case Method::OnCityInit:    return "on_city_init";
+        default:                    return "unknown";
+    }
+}
+
+std::string PluginStats::FormatReport()
+{
+    std::string report;
+    char line[256];
+
+    snprintf(line, sizeof(line), "%-24s %-16s %10s %12s %9s %9s %9s\n",
+             "plugin", "method", "calls", "total_us", "p50_us", "p99_us", "max_us");
+    report += line;
+
+    for (const auto& snapshot : Snapshot())
+    {
+        for (size_t m = 0; m < kMethodCount; m++)
+        {
+            const auto& stats = snapshot.methods[m];
+            if (stats.callCount == 0)
+            {
+                continue;
+            }
+            snprintf(line, sizeof(line), "%-24s %-16s %10llu %12llu %9llu %9llu %9llu\n",
+                     snapshot.pluginName.c_str(),
+                     MethodName(static_cast<Method>(m)),
+                     static_cast<unsigned long long>(stats.callCount),
+                     static_cast<unsigned long long>(stats.totalMicros),
+                     static_cast<unsigned long long>(PercentileMicros(stats, 0.50)),
+                     static_cast<unsigned long long>(PercentileMicros(stats, 0.99)),
+                     static_cast<unsigned long long>(stats.maxMicros));
+            report += line;
+        }
+    }
+
+    if (report.empty())
+    {
+        report = "No plugin calls recorded yet\n";
+    }
+
+    // Budget-scheduler summary: only plugins that ever blew their frame
+    // budget show up here
+    for (const auto& snapshot : Snapshot())
+    {
+        if (snapshot.budgetOverruns > 0)
+        {
+            snprintf(line, sizeof(line), "%-24s exceeded its frame budget %llu times\n",
+                     snapshot.pluginName.c_str(),
+                     static_cast<unsigned long long>(snapshot.budgetOverruns));
+            report += line;
+        }
+    }
+    return report;
+}
+
+PluginStats::ScopedTimer::ScopedTimer(int slot, Method method)
+    : slot(slot)
+    , method(method)
+    , startTicks(QpcNow())
+{
+}
+
+PluginStats::ScopedTimer::~ScopedTimer()
+{
+    int64_t elapsed = QpcNow() - startTicks;
+    uint64_t micros = static_cast<uint64_t>(elapsed * 1000000 / QpcFrequency());
+    Record(slot, method, micros);
+}
+
+uint64_t PluginStats::ScopedTimer::ElapsedMicros() const
+{
+    int64_t elapsed = QpcNow() - startTicks;
+    return static_cast<uint64_t>(elapsed * 1000000 / QpcFrequency());
+}
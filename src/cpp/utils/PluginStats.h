@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Per-plugin, per-method dispatch timing. PythonManager wraps every plugin
+// call in a ScopedTimer; recording is a handful of relaxed atomic increments
+// into fixed-size slots, so the hot path never allocates or takes a lock.
+// Timing uses QueryPerformanceCounter. The data surfaces through the
+// built-in "pystats" cheat and sc4_native.get_plugin_stats().
+class PluginStats
+{
+public:
+    // The plugin entry points worth attributing frame time to
+    enum class Method : uint32_t
+    {
+        HandleMessage = 0,
+        HandleCheat,
+        OnCityInit,
+        Count
+    };
+
+    static constexpr size_t kMaxPlugins = 64;
+
+    // Log2-microsecond histogram: bucket i counts calls in [2^i, 2^(i+1)) us,
+    // bucket 0 additionally holds sub-microsecond calls. 24 buckets reach
+    // past 8 seconds, far beyond anything a frame survives.
+    static constexpr size_t kBucketCount = 24;
+
+    struct MethodStats
+    {
+        uint64_t callCount = 0;
+        uint64_t totalMicros = 0;
+        uint64_t maxMicros = 0;
+        uint32_t buckets[kBucketCount] = {};
+    };
+
+    struct PluginSnapshot
+    {
+        std::string pluginName;
+        MethodStats methods[static_cast<size_t>(Method::Count)];
+        uint64_t budgetOverruns = 0;
+    };
+
+    // Returns the plugin's slot index, creating one on first registration.
+    // Slots survive plugin reloads so timings accumulate across a session.
+    // Returns -1 when all kMaxPlugins slots are taken; Record() ignores it.
+    static int RegisterPlugin(const std::string& name);
+
+    // Record one call of `micros` duration. Safe from any thread.
+    static void Record(int slot, Method method, uint64_t micros);
+
+    // Count one handler call that exceeded the plugin's frame-time budget
+    // (see the scheduler in PythonManager). Safe from any thread.
+    static void RecordOverrun(int slot);
+
+    // Consistent-enough copy of all counters for reporting; individual
+    // counters are read relaxed, which is fine for diagnostics
+    static std::vector<PluginSnapshot> Snapshot();
+
+    // Zero all counters, keeping slot assignments
+    static void Reset();
+
+    // Percentile estimate from the histogram (upper bucket bound), so p50
+    // and p99 cost no per-call bookkeeping beyond the bucket increment
+    static uint64_t PercentileMicros(const MethodStats& stats, double percentile);
+
+    static const char* MethodName(Method method);
+
+    // Multi-line human-readable table for the "pystats" cheat dump
+    static std::string FormatReport();
+
+    // RAII wrapper around a single plugin call: QueryPerformanceCounter at
+    // construction and destruction, one Record() on the way out
+    class ScopedTimer
+    {
+    public:
+        ScopedTimer(int slot, Method method);
+        ~ScopedTimer();
+
+        // Time elapsed so far, for callers that also need the duration
+        // (e.g. budget enforcement) without keeping their own timestamps
+        uint64_t ElapsedMicros() const;
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        int slot;
+        Method method;
+        int64_t startTicks;
+    };
+
+private:
+    PluginStats() = default;
+};
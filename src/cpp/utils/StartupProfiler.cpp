@@ -0,0 +1,164 @@
+#include "StartupProfiler.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+#include <windows.h>
+
+namespace
+{
+    std::mutex s_mutex;
+    StartupProfiler::Entry s_entries[StartupProfiler::kMaxEntries];
+    size_t s_entryCount = 0;
+    bool s_finished = false;
+
+    int64_t QpcFrequency()
+    {
+        static int64_t frequency = []() {
+            LARGE_INTEGER freq;
+            QueryPerformanceFrequency(&freq);
+            return freq.QuadPart;
+        }();
+        return frequency;
+    }
+
+    uint64_t QpcNow()
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        return static_cast<uint64_t>(now.QuadPart);
+    }
+
+    // Tick origin for the report's start offsets: captured the first time
+    // any phase is recorded, so phase starts read as "microseconds into
+    // startup"
+    uint64_t EpochTicks()
+    {
+        static uint64_t epoch = QpcNow();
+        return epoch;
+    }
+
+    uint64_t TicksToMicros(uint64_t ticks)
+    {
+        return ticks * 1'000'000ull / static_cast<uint64_t>(QpcFrequency());
+    }
+
+    // Phase names are ASCII identifiers and plugin stems; quote the two
+    // characters that would break the JSON string
+    void WriteJsonString(FILE* file, const char* text)
+    {
+        fputc('"', file);
+        for (const char* c = text; *c; c++)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                fputc('\\', file);
+            }
+            fputc(*c, file);
+        }
+        fputc('"', file);
+    }
+}
+
+StartupProfiler::Scope::Scope(std::string phaseName)
+    : name(std::move(phaseName))
+    , startTicks(QpcNow())
+{
+    EpochTicks();  // Anchor the origin no later than the first phase start
+}
+
+StartupProfiler::Scope::~Scope()
+{
+    Record(name, startTicks, QpcNow());
+}
+
+void StartupProfiler::Record(const std::string& name, uint64_t startTicks, uint64_t endTicks)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_finished || s_entryCount >= kMaxEntries)
+    {
+        return;
+    }
+
+    Entry& entry = s_entries[s_entryCount++];
+    strncpy(entry.name, name.c_str(), kMaxNameLength);
+    entry.name[kMaxNameLength] = '\0';
+    entry.startMicros = TicksToMicros(startTicks - EpochTicks());
+    entry.durationMicros = TicksToMicros(endTicks - startTicks);
+    entry.threadId = GetCurrentThreadId();
+}
+
+void StartupProfiler::WriteReport()
+{
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (s_finished)
+        {
+            return;
+        }
+        s_finished = true;
+        entries.assign(s_entries, s_entries + s_entryCount);
+    }
+
+    // Scopes land in completion order (children before parents); the
+    // report reads better in timeline order
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.startMicros < b.startMicros; });
+
+    // Log the slowest phases even if the file write fails; this is the
+    // line support asks users for first
+    std::vector<const Entry*> byDuration;
+    byDuration.reserve(entries.size());
+    for (const Entry& entry : entries)
+    {
+        byDuration.push_back(&entry);
+    }
+    std::sort(byDuration.begin(), byDuration.end(),
+              [](const Entry* a, const Entry* b) {
+                  return a->durationMicros > b->durationMicros;
+              });
+    size_t top = byDuration.size() < 5 ? byDuration.size() : 5;
+    for (size_t i = 0; i < top; i++)
+    {
+        LOG_INFO("Startup phase #{}: '{}' took {} ms", i + 1, byDuration[i]->name,
+                 byDuration[i]->durationMicros / 1000);
+    }
+
+    const char* userProfile = std::getenv("USERPROFILE");
+    if (!userProfile)
+    {
+        return;
+    }
+    std::filesystem::path reportPath = std::filesystem::path(userProfile) /
+        "Documents" / "SimCity 4" / "SC4PythonFramework.startup.json";
+
+    FILE* file = fopen(reportPath.string().c_str(), "wb");
+    if (!file)
+    {
+        LOG_WARN("StartupProfiler: cannot write '{}'", reportPath.string());
+        return;
+    }
+
+    fprintf(file, "{\n  \"version\": 1,\n  \"phases\": [\n");
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const Entry& entry = entries[i];
+        fprintf(file, "    {\"name\": ");
+        WriteJsonString(file, entry.name);
+        fprintf(file, ", \"thread\": %lu, \"start_us\": %llu, \"duration_us\": %llu}%s\n",
+                static_cast<unsigned long>(entry.threadId),
+                static_cast<unsigned long long>(entry.startMicros),
+                static_cast<unsigned long long>(entry.durationMicros),
+                i + 1 < entries.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    LOG_INFO("Startup timing report written: {} ({} phases)",
+             reportPath.string(), entries.size());
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Startup phase profiler. Between the DllDirector's hook sequence, the
+// Initialize() phases on the background thread, cheat manager setup and
+// the per-plugin import/initialize calls there are a dozen-plus startup
+// stages; this records each named phase (start, duration, thread) into a
+// fixed preallocated buffer so a slow city load can be attributed to a
+// specific stage from the field, without a debugger.
+//
+// Usage is a scoped timer per phase. At the end of PostAppInit the
+// DllDirector calls WriteReport(), which persists the phases as JSON
+// next to SC4PythonFramework.log, logs the top offenders, and stops
+// recording - the facility only ever covers startup.
+class StartupProfiler
+{
+public:
+    static constexpr size_t kMaxEntries = 128;
+    static constexpr size_t kMaxNameLength = 47;
+
+    struct Entry
+    {
+        char name[kMaxNameLength + 1];
+        uint64_t startMicros;     // Relative to the first recorded phase
+        uint64_t durationMicros;
+        uint32_t threadId;
+    };
+
+    // RAII phase timer: records one entry when it goes out of scope.
+    // Phases may nest (a plugin import inside LoadPlugins inside
+    // PostAppInit); each level gets its own entry.
+    class Scope
+    {
+    public:
+        explicit Scope(std::string phaseName);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::string name;
+        uint64_t startTicks;
+    };
+
+    // Writes the timing report as JSON next to the log, logs the slowest
+    // phases, and stops recording. Called once when startup completes.
+    static void WriteReport();
+
+private:
+    // Appends one completed phase; drops silently once the buffer is
+    // full or the report has been written
+    static void Record(const std::string& name, uint64_t startTicks, uint64_t endTicks);
+
+    StartupProfiler() = default;
+};
@@ -0,0 +1,318 @@
+#include "StateStore.h"
+#include "Logger.h"
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <windows.h>
+
+namespace
+{
+    std::mutex s_mutex;
+    std::unordered_map<std::string, StateStore::Value> s_entries;
+    std::string s_filePath;
+    bool s_open = false;
+    bool s_dirty = false;
+
+    // Write-behind flusher: woken early by Close()/FlushNow(), otherwise
+    // checks the dirty flag once per interval
+    std::thread s_flushThread;
+    std::condition_variable s_flushCv;
+    bool s_stopRequested = false;
+
+    // City names come from save files and can contain anything; keep the
+    // store filename to a conservative character set
+    std::string SanitizeCityName(const std::string& cityName)
+    {
+        std::string sanitized;
+        sanitized.reserve(cityName.size());
+        for (char c : cityName)
+        {
+            if (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_')
+            {
+                sanitized += c;
+            }
+            else if (c == ' ')
+            {
+                sanitized += '_';
+            }
+        }
+        return sanitized.empty() ? "unnamed" : sanitized;
+    }
+
+    std::string StoreDirectory()
+    {
+        const char* userProfile = std::getenv("USERPROFILE");
+        if (!userProfile)
+        {
+            return "";
+        }
+        std::filesystem::path dir =
+            std::filesystem::path(userProfile) / "Documents" / "SimCity 4" / "PythonState";
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+        return ec ? "" : dir.string();
+    }
+
+    // Reads the whole file into s_entries; a short or malformed file logs
+    // and keeps whatever parsed cleanly before the damage
+    void LoadFile(const std::string& path)
+    {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            return;  // First run for this city
+        }
+
+        char magic[4];
+        uint32_t version = 0;
+        uint32_t count = 0;
+        if (fread(magic, 1, 4, file) != 4 || memcmp(magic, "S4KV", 4) != 0 ||
+            fread(&version, sizeof(version), 1, file) != 1 || version != StateStore::kVersion ||
+            fread(&count, sizeof(count), 1, file) != 1)
+        {
+            LOG_WARN("StateStore: '{}' has a bad header; starting empty", path);
+            fclose(file);
+            return;
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint8_t type = 0;
+            uint16_t keyLength = 0;
+            uint32_t valueLength = 0;
+            if (fread(&type, sizeof(type), 1, file) != 1 ||
+                fread(&keyLength, sizeof(keyLength), 1, file) != 1)
+            {
+                break;
+            }
+
+            std::string key(keyLength, '\0');
+            if (keyLength > 0 && fread(key.data(), 1, keyLength, file) != keyLength)
+            {
+                break;
+            }
+            if (fread(&valueLength, sizeof(valueLength), 1, file) != 1)
+            {
+                break;
+            }
+
+            StateStore::Value value;
+            value.type = static_cast<StateStore::ValueType>(type);
+            value.data.resize(valueLength);
+            if (valueLength > 0 && fread(value.data.data(), 1, valueLength, file) != valueLength)
+            {
+                break;
+            }
+            s_entries[std::move(key)] = std::move(value);
+        }
+
+        fclose(file);
+        LOG_INFO("StateStore: loaded {} entries from '{}'", s_entries.size(), path);
+    }
+
+    // Serializes a copy of the entries taken under the lock, then writes
+    // temp + rename so a crash mid-write never corrupts the previous file
+    bool WriteFile(const std::string& path,
+                   const std::unordered_map<std::string, StateStore::Value>& entries)
+    {
+        std::string tempPath = path + ".tmp";
+        FILE* file = fopen(tempPath.c_str(), "wb");
+        if (!file)
+        {
+            LOG_WARN("StateStore: cannot open '{}' for writing", tempPath);
+            return false;
+        }
+
+        fwrite("S4KV", 1, 4, file);
+        uint32_t version = StateStore::kVersion;
+        fwrite(&version, sizeof(version), 1, file);
+        uint32_t count = static_cast<uint32_t>(entries.size());
+        fwrite(&count, sizeof(count), 1, file);
+
+        for (const auto& [key, value] : entries)
+        {
+            uint8_t type = static_cast<uint8_t>(value.type);
+            uint16_t keyLength = static_cast<uint16_t>(key.size());
+            uint32_t valueLength = static_cast<uint32_t>(value.data.size());
+            fwrite(&type, sizeof(type), 1, file);
+            fwrite(&keyLength, sizeof(keyLength), 1, file);
+            fwrite(key.data(), 1, keyLength, file);
+            fwrite(&valueLength, sizeof(valueLength), 1, file);
+            fwrite(value.data.data(), 1, valueLength, file);
+        }
+
+        bool ok = fclose(file) == 0;
+        if (ok)
+        {
+            ok = MoveFileExA(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+        }
+        if (!ok)
+        {
+            LOG_WARN("StateStore: failed to commit '{}' (error {})", path, GetLastError());
+        }
+        return ok;
+    }
+
+    // Snapshots dirty state under the lock, writes with the lock released
+    // so Put()/Get() on the game thread never wait on disk
+    void FlushIfDirty()
+    {
+        std::string path;
+        std::unordered_map<std::string, StateStore::Value> copy;
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (!s_open || !s_dirty)
+            {
+                return;
+            }
+            path = s_filePath;
+            copy = s_entries;
+            s_dirty = false;
+        }
+
+        if (!WriteFile(path, copy))
+        {
+            // Try again next interval
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_dirty = true;
+        }
+    }
+
+    void FlushThreadMain()
+    {
+        std::unique_lock<std::mutex> lock(s_mutex);
+        while (!s_stopRequested)
+        {
+            s_flushCv.wait_for(lock, std::chrono::milliseconds(StateStore::kFlushIntervalMs));
+            if (s_stopRequested)
+            {
+                break;
+            }
+            lock.unlock();
+            FlushIfDirty();
+            lock.lock();
+        }
+    }
+}
+
+bool StateStore::Open(const std::string& cityName)
+{
+    Close();
+
+    std::string directory = StoreDirectory();
+    if (directory.empty())
+    {
+        LOG_WARN("StateStore disabled: no writable state directory");
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_filePath = (std::filesystem::path(directory) /
+                      (SanitizeCityName(cityName) + ".sc4kv")).string();
+        s_entries.clear();
+        LoadFile(s_filePath);
+        s_open = true;
+        s_dirty = false;
+        s_stopRequested = false;
+    }
+
+    s_flushThread = std::thread(FlushThreadMain);
+    LOG_INFO("StateStore: open for city '{}' at '{}'", cityName, s_filePath);
+    return true;
+}
+
+void StateStore::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_open)
+        {
+            return;
+        }
+        s_stopRequested = true;
+    }
+    s_flushCv.notify_all();
+    if (s_flushThread.joinable())
+    {
+        s_flushThread.join();
+    }
+
+    // Final synchronous flush now that the background writer is gone
+    FlushIfDirty();
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_entries.clear();
+    s_open = false;
+    LOG_INFO("StateStore: closed '{}'", s_filePath);
+}
+
+bool StateStore::IsOpen()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_open;
+}
+
+void StateStore::Put(const std::string& key, Value value)
+{
+    if (key.size() > kMaxKeyLength)
+    {
+        LOG_WARN("StateStore: key too long ({} bytes); entry dropped", key.size());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_open)
+    {
+        return;
+    }
+    s_entries[key] = std::move(value);
+    s_dirty = true;
+}
+
+bool StateStore::Get(const std::string& key, Value& out)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto it = s_entries.find(key);
+    if (it == s_entries.end())
+    {
+        return false;
+    }
+    out = it->second;
+    return true;
+}
+
+bool StateStore::Erase(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_entries.erase(key) == 0)
+    {
+        return false;
+    }
+    s_dirty = true;
+    return true;
+}
+
+std::vector<std::string> StateStore::Keys()
+{
+    std::vector<std::string> keys;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    keys.reserve(s_entries.size());
+    for (const auto& [key, value] : s_entries)
+    {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+void StateStore::FlushNow()
+{
+    FlushIfDirty();
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Per-city persistent key-value store with write-behind flushing.
+// Plugins used to persist state by serializing JSON from Python at
+// shutdown - slow to load, slow to save, and gone on a crash. The store
+// instead keeps every entry in memory (reads and writes after warm-up
+// are a hash probe under a short lock) and a background thread rewrites
+// the binary file whenever entries have changed, so saves never block
+// the game thread and crash durability is bounded by the flush interval.
+//
+// Lifecycle follows the city: the DllDirector opens the store when a
+// city initializes (loading its file if one exists) and closes it with
+// a final synchronous flush when the city shuts down. One store is open
+// at a time; keys are plugin-namespaced on the Python side (see the
+// state property in sc4_plugin_base).
+//
+// File format (little-endian), rewritten atomically via temp + rename:
+//   header:  "S4KV", u32 version, u32 entry count
+//   entries: u8 type (1=bytes, 2=str, 3=int, 4=float),
+//            u16 key length, key bytes, u32 value length, value bytes
+// int is an i64 and float a f64, both stored as their 8 raw bytes.
+class StateStore
+{
+public:
+    static constexpr uint32_t kVersion = 1;
+    static constexpr uint32_t kFlushIntervalMs = 2000;
+    static constexpr size_t kMaxKeyLength = UINT16_MAX;
+
+    enum class ValueType : uint8_t
+    {
+        Bytes = 1,
+        Str = 2,
+        Int = 3,
+        Float = 4
+    };
+
+    struct Value
+    {
+        ValueType type = ValueType::Bytes;
+        std::vector<uint8_t> data;
+    };
+
+    // Loads the city's store file (if any) and starts the flush thread.
+    // Called on the game thread at city init; an already-open store for
+    // a different city is closed first. Failure to read an existing file
+    // starts empty rather than failing the open.
+    static bool Open(const std::string& cityName);
+
+    // Final synchronous flush and flush-thread join. Idempotent; called
+    // at city shutdown and defensively at app shutdown.
+    static void Close();
+
+    static bool IsOpen();
+
+    // Inserts or replaces an entry and marks the store dirty; the flush
+    // thread picks the change up within kFlushIntervalMs
+    static void Put(const std::string& key, Value value);
+
+    // Copies the entry for key into out; false when absent
+    static bool Get(const std::string& key, Value& out);
+
+    // Removes an entry; false when absent
+    static bool Erase(const std::string& key);
+
+    // All keys currently in the store, unordered
+    static std::vector<std::string> Keys();
+
+    // Synchronous flush for callers that need durability now (e.g. a
+    // plugin about to do something risky); normal saves should rely on
+    // the write-behind thread
+    static void FlushNow();
+
+private:
+    StateStore() = default;
+};
@@ -0,0 +1,122 @@
+#include "Telemetry.h"
+#include "Logger.h"
+#include "PluginStats.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <windows.h>
+
+namespace
+{
+    HANDLE s_mapping = nullptr;
+    Telemetry::Layout* s_region = nullptr;
+    uint32_t s_publishCount = 0;
+
+    // Refreshes the per-plugin table from the instrumentation counters.
+    // Called inside the seqlock write section, but only once per
+    // kPluginRefreshPeriod publishes - it walks the stats snapshot.
+    void RefreshPluginTable()
+    {
+        auto snapshots = PluginStats::Snapshot();
+        uint32_t count = 0;
+        for (const auto& snapshot : snapshots)
+        {
+            if (count >= Telemetry::kMaxPlugins)
+            {
+                break;
+            }
+            auto& entry = s_region->plugins[count];
+            strncpy(entry.name, snapshot.pluginName.c_str(), Telemetry::kMaxNameLength);
+            entry.name[Telemetry::kMaxNameLength] = '\0';
+
+            const auto& message =
+                snapshot.methods[static_cast<size_t>(PluginStats::Method::HandleMessage)];
+            entry.messageCalls = message.callCount;
+            entry.messageTotalMicros = message.totalMicros;
+            entry.messageMaxMicros = message.maxMicros;
+            entry.budgetOverruns = snapshot.budgetOverruns;
+            count++;
+        }
+        s_region->pluginCount = count;
+    }
+}
+
+bool Telemetry::Initialize()
+{
+    if (s_region)
+    {
+        return true;
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "Local\\SC4PyFramework_Telemetry_%lu", GetCurrentProcessId());
+
+    s_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                   0, sizeof(Layout), name);
+    if (!s_mapping)
+    {
+        LOG_WARN("Telemetry disabled: CreateFileMapping failed (error {})", GetLastError());
+        return false;
+    }
+
+    s_region = static_cast<Layout*>(
+        MapViewOfFile(s_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Layout)));
+    if (!s_region)
+    {
+        LOG_WARN("Telemetry disabled: MapViewOfFile failed (error {})", GetLastError());
+        CloseHandle(s_mapping);
+        s_mapping = nullptr;
+        return false;
+    }
+
+    memset(s_region, 0, sizeof(Layout));
+    s_region->magic = kMagic;
+    s_region->version = kLayoutVersion;
+    s_region->pid = GetCurrentProcessId();
+    // sequence stays 0 (even): readers see a consistent empty block
+
+    LOG_INFO("Telemetry region mapped: {}", name);
+    return true;
+}
+
+void Telemetry::Shutdown()
+{
+    if (s_region)
+    {
+        UnmapViewOfFile(s_region);
+        s_region = nullptr;
+    }
+    if (s_mapping)
+    {
+        CloseHandle(s_mapping);
+        s_mapping = nullptr;
+    }
+}
+
+void Telemetry::Publish(const CityFields& city, uint64_t messagesDispatched,
+                        uint64_t cheatsDispatched)
+{
+    if (!s_region)
+    {
+        return;
+    }
+
+    // Seqlock write section: odd sequence marks the block as in flight;
+    // the fences keep the payload stores inside the bracket
+    s_region->sequence++;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    s_region->cityDate = city.date;
+    s_region->cityFunds = city.funds;
+    s_region->cityStats = city.stats;
+    s_region->messagesDispatched = messagesDispatched;
+    s_region->cheatsDispatched = cheatsDispatched;
+
+    if (s_publishCount++ % kPluginRefreshPeriod == 0)
+    {
+        RefreshPluginTable();
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    s_region->sequence++;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../wrappers/CityWrapper.h"
+
+// Shared-memory telemetry export for external monitoring. A named file
+// mapping ("Local\SC4PyFramework_Telemetry_<pid>") holds one versioned POD
+// block that the game updates in place; a fleet agent maps it read-only
+// and samples at its own rate with zero game-side I/O.
+//
+// Concurrency is a seqlock: `sequence` is incremented to an odd value
+// before a publish and to an even value after. A reader copies the block,
+// re-reads `sequence`, and retries if it changed or was odd - the game
+// thread never blocks on a reader.
+//
+// Per-cycle publish cost is a handful of stores (city fields plus
+// throughput counters); the per-plugin latency table is refreshed only
+// every kPluginRefreshPeriod publishes, which is far below the 1 Hz
+// sampling it feeds.
+class Telemetry
+{
+public:
+    static constexpr uint32_t kMagic = 0x53345054;  // "S4PT"
+    static constexpr uint32_t kLayoutVersion = 1;
+    static constexpr uint32_t kMaxPlugins = 64;
+    static constexpr uint32_t kMaxNameLength = 31;
+    static constexpr uint32_t kPluginRefreshPeriod = 64;
+
+    // Everything below is plain-old-data, fixed offsets, no padding
+    // surprises: external decoders depend on this layout staying stable
+    // within a kLayoutVersion.
+    struct PluginEntry
+    {
+        char name[kMaxNameLength + 1];
+        uint64_t messageCalls;
+        uint64_t messageTotalMicros;
+        uint64_t messageMaxMicros;
+        uint64_t budgetOverruns;
+    };
+
+    struct Layout
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t pid;
+        uint32_t sequence;       // Seqlock; odd while a publish is in flight
+
+        // City state
+        uint32_t cityDate;
+        uint32_t cityFunds;
+        CityWrapper::CityStats cityStats;
+
+        // Throughput since startup
+        uint64_t messagesDispatched;
+        uint64_t cheatsDispatched;
+
+        // Per-plugin latency table from the instrumentation block
+        uint32_t pluginCount;
+        PluginEntry plugins[kMaxPlugins];
+    };
+
+    struct CityFields
+    {
+        uint32_t date = 0;
+        uint32_t funds = 0;
+        CityWrapper::CityStats stats{};
+    };
+
+    // Creates and maps the region; safe to call when already initialized.
+    // Failure disables telemetry (Publish becomes a null check) rather
+    // than affecting the game.
+    static bool Initialize();
+    static void Shutdown();
+
+    // One seqlocked in-place update; called from the game thread once per
+    // exec cycle
+    static void Publish(const CityFields& city, uint64_t messagesDispatched,
+                        uint64_t cheatsDispatched);
+
+private:
+    Telemetry() = default;
+};
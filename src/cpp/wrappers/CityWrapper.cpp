@@ -13,8 +13,21 @@
 
 CityWrapper::CityWrapper()
     : city(nullptr)
+    , budgetSim(nullptr)
+    , residentialSim(nullptr)
+    , powerSim(nullptr)
+    , plumbingSim(nullptr)
+    , clock24(nullptr)
     , statsCacheValid(false)
+    , gridBuffersValid(false)
+    , sampleHead(0)
+    , sampleCount(0)
+    , sampleInterval(1)
+    , tickCounter(0)
 {
+    // Default history: one sample per tick, enough rows for a long session.
+    // Plugins can re-dimension through sc4_native configure_stats_recorder.
+    sampleRing.resize(4096);
 }
 
 CityWrapper::~CityWrapper()
@@ -44,77 +57,98 @@ std::string CityWrapper::GetCityName() const
 uint32_t CityWrapper::GetCityPopulation() const
 {
     if (!IsValid()) return 0;
-    
-    // Get residential simulator and query population
-    cISC4ResidentialSimulator* resSimulator = city->GetResidentialSimulator();
-    if (resSimulator)
+
+    if (residentialSim)
     {
         // This would need the proper method call to get population
-        // return resSimulator->GetTotalPopulation();
+        // return residentialSim->GetTotalPopulation();
     }
     return 0;
 }
 
 uint32_t CityWrapper::GetCityMoney() const
 {
-    if (!IsValid()) return 0;
-    
-    cISC4BudgetSimulator* budget = city->GetBudgetSimulator();
-    if (budget)
-    {
-        int64_t funds = budget->GetTotalFunds();
-        // Clamp to uint32_t range to prevent overflow
-        if (funds < 0) return 0;
-        if (funds > UINT32_MAX) return UINT32_MAX;
-        return static_cast<uint32_t>(funds);
-    }
-    return 0;
+    if (!budgetSim) return 0;
+
+    int64_t funds = budgetSim->GetTotalFunds();
+    // Clamp to uint32_t range to prevent overflow
+    if (funds < 0) return 0;
+    if (funds > UINT32_MAX) return UINT32_MAX;
+    return static_cast<uint32_t>(funds);
 }
 
 bool CityWrapper::SetCityMoney(uint32_t amount)
 {
-    if (!IsValid()) return false;
-    
-    cISC4BudgetSimulator* budget = city->GetBudgetSimulator();
-    if (budget)
+    if (!budgetSim) return false;
+
+    // Safe cast since uint32_t always fits in int64_t
+    return budgetSim->SetTotalFunds(static_cast<int64_t>(amount));
+}
+
+bool CityWrapper::AddCityMoney(int32_t amount)
+{
+    if (!budgetSim) return false;
+
+    // Check for potential overflow before performing operation
+    int64_t currentFunds = budgetSim->GetTotalFunds();
+    int64_t newFunds = currentFunds + static_cast<int64_t>(amount);
+
+    // Ensure result stays within valid range
+    if (newFunds < 0) {
+        // Can't have negative funds, set to 0
+        return budgetSim->SetTotalFunds(0);
+    }
+    if (newFunds > UINT32_MAX) {
+        // Clamp to maximum uint32_t value
+        return budgetSim->SetTotalFunds(UINT32_MAX);
+    }
+
+    if (amount >= 0)
     {
-        // Safe cast since uint32_t always fits in int64_t
-        return budget->SetTotalFunds(static_cast<int64_t>(amount));
+        return budgetSim->DepositFunds(static_cast<int64_t>(amount));
+    }
+    else
+    {
+        return budgetSim->WithdrawFunds(static_cast<int64_t>(-amount));
     }
-    return false;
 }
 
-bool CityWrapper::AddCityMoney(int32_t amount)
+size_t CityWrapper::ApplyBudgetBatch(const int32_t* deltas, size_t count, uint8_t* applied)
 {
-    if (!IsValid()) return false;
-    
-    cISC4BudgetSimulator* budget = city->GetBudgetSimulator();
-    if (budget)
-    {
-        // Check for potential overflow before performing operation
-        int64_t currentFunds = budget->GetTotalFunds();
-        int64_t newFunds = currentFunds + static_cast<int64_t>(amount);
-        
-        // Ensure result stays within valid range
-        if (newFunds < 0) {
-            // Can't have negative funds, set to 0
-            return budget->SetTotalFunds(0);
-        }
-        if (newFunds > UINT32_MAX) {
-            // Clamp to maximum uint32_t value
-            return budget->SetTotalFunds(UINT32_MAX);
-        }
-        
-        if (amount >= 0)
+    if (!budgetSim)
+    {
+        for (size_t i = 0; i < count; i++)
         {
-            return budget->DepositFunds(static_cast<int64_t>(amount));
+            applied[i] = 0;
         }
-        else
+        return 0;
+    }
+
+    // One funds read up front; every delta is validated against a running
+    // total so the batch behaves as if applied one by one, but the
+    // simulator only sees the final clamped write
+    int64_t startingFunds = budgetSim->GetTotalFunds();
+    int64_t runningFunds = startingFunds;
+    size_t appliedCount = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        int64_t next = runningFunds + static_cast<int64_t>(deltas[i]);
+        if (next < 0 || next > UINT32_MAX)
         {
-            return budget->WithdrawFunds(static_cast<int64_t>(-amount));
+            applied[i] = 0;
+            continue;
         }
+        runningFunds = next;
+        applied[i] = 1;
+        appliedCount++;
+    }
+
+    if (runningFunds != startingFunds)
+    {
+        budgetSim->SetTotalFunds(runningFunds);
     }
-    return false;
+    return appliedCount;
 }
 
 bool CityWrapper::GetMayorMode() const
@@ -149,13 +183,11 @@ uint32_t CityWrapper::GetCityDate() const
 uint32_t CityWrapper::GetCityTime() const
 {
     if (!IsValid()) return 0;
-    
-    // Get simulation time from 24-hour clock
-    cISC424HourClock* clock = city->Get24HourClock();
-    if (clock)
+
+    if (clock24)
     {
         // This would need proper implementation based on cISC424HourClock interface
-        // return clock->GetCurrentTime();
+        // return clock24->GetCurrentTime();
     }
     return 0;
 }
@@ -172,13 +204,22 @@ CityWrapper::CityStats CityWrapper::GetCityStats() const
 void CityWrapper::UpdateCityReference()
 {
     // Get current city from SC4App
-    city = nullptr; // Reset first
+    ClearCityReference(); // Reset first
     
     try {
         cISC4AppPtr pApp;
         if (pApp) {
             city = pApp->GetCity();
             if (city) {
+                // Batch-acquire every simulator interface once per city so
+                // the Python-visible getters become a null check plus a
+                // direct call instead of a COM fetch per invocation
+                budgetSim = city->GetBudgetSimulator();
+                residentialSim = city->GetResidentialSimulator();
+                powerSim = city->GetPowerSimulator();
+                plumbingSim = city->GetPlumbingSimulator();
+                clock24 = city->Get24HourClock();
+
                 std::string cityName = GetCityName();
                 LOG_INFO("CityWrapper: Successfully got city: '{}'", cityName);
             } else {
@@ -198,9 +239,129 @@ void CityWrapper::UpdateCityReference()
     InvalidateStatsCache();
 }
 
+const CityWrapper::GridBuffer& CityWrapper::GetGridBuffer(GridLayer layer) const
+{
+    if (!gridBuffersValid)
+    {
+        UpdateGridBuffers();
+    }
+    return gridBuffers[static_cast<size_t>(layer)];
+}
+
+void CityWrapper::ConfigureRecorder(uint32_t tickInterval, size_t capacity)
+{
+    sampleInterval = tickInterval > 0 ? tickInterval : 1;
+    sampleRing.assign(capacity > 0 ? capacity : 1, StatsSample{});
+    sampleHead = 0;
+    sampleCount = 0;
+    tickCounter = 0;
+}
+
+void CityWrapper::RecordTick()
+{
+    if (!IsValid())
+    {
+        return;
+    }
+
+    if (++tickCounter < sampleInterval)
+    {
+        return;
+    }
+    tickCounter = 0;
+
+    // One row into preallocated storage: the stats come from the cache
+    // (refreshed only when the sim invalidated it), so the steady-state
+    // cost is the struct copy
+    StatsSample& row = sampleRing[sampleHead];
+    row.date = GetCityDate();
+    row.funds = GetCityMoney();
+    row.stats = GetCityStats();
+
+    sampleHead = (sampleHead + 1) % sampleRing.size();
+    if (sampleCount < sampleRing.size())
+    {
+        sampleCount++;
+    }
+}
+
+const CityWrapper::StatsSample* CityWrapper::GetSampleData()
+{
+    // Once the ring has wrapped, the oldest row sits at sampleHead; rotate
+    // so callers get one contiguous oldest-first block. O(n), but only on
+    // retrieval - sampling stays a plain append.
+    if (sampleCount == sampleRing.size() && sampleHead != 0)
+    {
+        std::rotate(sampleRing.begin(), sampleRing.begin() + sampleHead, sampleRing.end());
+        sampleHead = 0;
+    }
+    return sampleRing.data();
+}
+
+void CityWrapper::PublishSnapshot()
+{
+    if (!IsValid())
+    {
+        return;
+    }
+
+    Snapshot& back = snapshotPair[snapshotBack];
+    {
+        // Only a reader that still holds the retired buffer can contend
+        // here, and only for the duration of its copy
+        std::lock_guard<std::mutex> lock(snapshotLocks[snapshotBack]);
+
+        back.generation = ++snapshotGeneration;
+        back.date = GetCityDate();
+        back.funds = GetCityMoney();
+        back.stats = GetCityStats();
+        back.name = GetCityName();
+        for (size_t i = 0; i < static_cast<size_t>(GridLayer::Count); i++)
+        {
+            const GridBuffer& grid = GetGridBuffer(static_cast<GridLayer>(i));
+            back.grids[i].width = grid.width;
+            back.grids[i].height = grid.height;
+            back.grids[i].cells = grid.cells;  // Copies into the buffer's existing storage
+        }
+    }
+
+    publishedSnapshot.store(&back, std::memory_order_release);
+    snapshotBack ^= 1;
+}
+
+bool CityWrapper::CopySnapshot(Snapshot& out) const
+{
+    const Snapshot* snap = publishedSnapshot.load(std::memory_order_acquire);
+    if (!snap)
+    {
+        return false;
+    }
+
+    // The buffer's lock orders this copy against any rewrite: if the
+    // writer flipped twice since the load above and is refilling this
+    // buffer, the copy waits and then sees the newer complete snapshot
+    size_t index = static_cast<size_t>(snap - snapshotPair);
+    std::lock_guard<std::mutex> lock(snapshotLocks[index]);
+    out = snapshotPair[index];
+    return true;
+}
+
+void CityWrapper::ClearCityReference()
+{
+    city = nullptr;
+    budgetSim = nullptr;
+    residentialSim = nullptr;
+    powerSim = nullptr;
+    plumbingSim = nullptr;
+    clock24 = nullptr;
+    InvalidateStatsCache();
+}
+
 void CityWrapper::InvalidateStatsCache()
 {
     statsCacheValid = false;
+    gridBuffersValid = false;
+    statsGeneration++;
 }
 
 void CityWrapper::UpdateStatsCache() const
@@ -219,7 +380,6 @@ void CityWrapper::UpdateStatsCache() const
     cachedStats.total_jobs = 0;             // Sum from various simulators
     
     // Power stats
-    cISC4PowerSimulator* powerSim = city->GetPowerSimulator();
     if (powerSim)
     {
         // These would need proper method calls based on cISC4PowerSimulator interface
@@ -228,13 +388,55 @@ void CityWrapper::UpdateStatsCache() const
     }
     
     // Water stats
-    cISC4PlumbingSimulator* waterSim = city->GetPlumbingSimulator();
-    if (waterSim)
+    if (plumbingSim)
     {
         // These would need proper method calls based on cISC4PlumbingSimulator interface
-        // cachedStats.water_produced = waterSim->GetTotalWaterProduced();
-        // cachedStats.water_consumed = waterSim->GetTotalWaterConsumed();
+        // cachedStats.water_produced = plumbingSim->GetTotalWaterProduced();
+        // cachedStats.water_consumed = plumbingSim->GetTotalWaterConsumed();
     }
     
     statsCacheValid = true;
+}
+
+void CityWrapper::UpdateGridBuffers() const
+{
+    // SC4 city tiles are 64/128/256 cells per side; until the city-size
+    // query is wired up we allocate for the large tile and publish the
+    // full extent. The buffers are reused across refreshes, so steady
+    // state is a fill with no allocation.
+    constexpr uint32_t kGridCells = 256;
+
+    for (auto& grid : gridBuffers)
+    {
+        grid.width = kGridCells;
+        grid.height = kGridCells;
+        grid.cells.resize(static_cast<size_t>(grid.width) * grid.height);
+        std::fill(grid.cells.begin(), grid.cells.end(), static_cast<uint8_t>(0));
+        grid.generation++;
+    }
+
+    if (IsValid())
+    {
+        // Power coverage
+        if (powerSim)
+        {
+            // Would copy the powered-cell map into
+            // gridBuffers[GridLayer::Power] based on the
+            // cISC4PowerSimulator interface, e.g.:
+            // powerSim->GetPowerGrid(gridBuffers[0].cells.data());
+        }
+
+        // Water coverage
+        if (plumbingSim)
+        {
+            // Would copy the watered-cell map into
+            // gridBuffers[GridLayer::Water] based on the
+            // cISC4PlumbingSimulator interface
+        }
+
+        // Traffic volume and land value would come from their respective
+        // simulators once those interfaces are wrapped
+    }
+
+    gridBuffersValid = true;
 }
\ No newline at end of file
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <cstdint>
 #include "cISC4City.h"
 #include "cISC4App.h"
 
+class cISC4BudgetSimulator;
+class cISC4ResidentialSimulator;
+class cISC4PowerSimulator;
+class cISC4PlumbingSimulator;
+class cISC424HourClock;
+
 class CityWrapper
 {
 public:
@@ -21,6 +29,13 @@ public:
     // City modification (safe operations only)
     bool SetCityMoney(uint32_t amount);
     bool AddCityMoney(int32_t amount);
+
+    // Transactional batch of signed funds adjustments: one funds read, one
+    // clamped write against the budget simulator, regardless of count.
+    // Entries apply in order against a running total; an entry that would
+    // push funds out of range is rejected (applied[i] = 0) and the rest
+    // continue. Returns the number of entries applied.
+    size_t ApplyBudgetBatch(const int32_t* deltas, size_t count, uint8_t* applied);
     
     // Mayor mode operations
     bool GetMayorMode() const;
@@ -44,15 +59,153 @@ public:
     };
     
     CityStats GetCityStats() const;
-    
+
+    // Spatial grid layers exposed to Python as zero-copy buffer views
+    // (see the sc4_native get_grid binding). The backing storage lives in
+    // CityWrapper, so a view handed to Python stays valid until the layer
+    // is refreshed; the per-layer generation counter lets callers detect
+    // that their view is stale.
+    enum class GridLayer
+    {
+        Power = 0,
+        Water,
+        Traffic,
+        LandValue,
+
+        Count
+    };
+
+    struct GridBuffer
+    {
+        std::vector<uint8_t> cells;  // Row-major, height rows of width cells
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t generation = 0;     // Bumped on every refresh
+    };
+
+    const GridBuffer& GetGridBuffer(GridLayer layer) const;
+
+    // Time-series stats recorder. The DllDirector calls RecordTick() on
+    // simulation messages; every sampleInterval-th tick appends one POD row
+    // (a ~40 byte memcpy, no Python involvement) into a preallocated ring.
+    // Python reads the whole history in a single binding crossing as a
+    // zero-copy uint32 view (see sc4_native get_stats_history).
+    struct StatsSample
+    {
+        uint32_t date;       // GetCityDate() at sample time
+        uint32_t funds;      // GetCityMoney() at sample time
+        CityStats stats;
+    };
+    static constexpr size_t kSampleFieldCount = sizeof(StatsSample) / sizeof(uint32_t);
+
+    // Reconfigure cadence and capacity; resets recorded history
+    void ConfigureRecorder(uint32_t tickInterval, size_t capacity);
+
+    // Called on every simulation tick message; samples when the interval
+    // counter elapses and a city is present
+    void RecordTick();
+
+    size_t GetSampleCount() const { return sampleCount; }
+
+    // Oldest-first contiguous view of the recorded rows. Linearizes the
+    // ring in place when it has wrapped (only pays on retrieval), so the
+    // returned pointer covers GetSampleCount() rows. The view is valid
+    // until the next RecordTick() or ConfigureRecorder().
+    const StatsSample* GetSampleData();
+
+    // Double-buffered snapshot of the full Python-visible city state.
+    // Every live getter above dereferences SC4 interfaces and is therefore
+    // game-thread only; off-thread consumers (async workers, isolated
+    // plugin hosts, the telemetry exporter) read from here instead. The
+    // game thread fills the back buffer of a pair and flips an atomic
+    // pointer; each buffer carries its own mutex, held by the writer only
+    // while filling and by readers only while copying. The payload holds
+    // strings and vectors, so a seqlock's copy-then-recheck is not an
+    // option - a torn read of reallocating storage can fault before any
+    // sequence re-check. In steady state the locks are uncontended: the
+    // writer touches the retired buffer, readers the published one.
+    struct Snapshot
+    {
+        struct Grid
+        {
+            std::vector<uint8_t> cells;  // Row-major, height rows of width cells
+            uint32_t width = 0;
+            uint32_t height = 0;
+        };
+
+        uint64_t generation = 0;  // Bumped once per publish
+        uint32_t date = 0;
+        uint32_t funds = 0;
+        CityStats stats{};
+        std::string name;
+        Grid grids[static_cast<size_t>(GridLayer::Count)];
+    };
+
+    // Fills and flips the back buffer from live city state. Game thread
+    // only; called once per exec cycle by the DllDirector. The back
+    // buffer's vectors and strings are reused, so steady state is copies
+    // into existing storage with no allocation.
+    void PublishSnapshot();
+
+    // Copies the most recently published snapshot into out. Safe from any
+    // thread; returns false if nothing has been published yet (no city).
+    bool CopySnapshot(Snapshot& out) const;
+
+    // Monotonic counter bumped on every cache invalidation. Python plugins
+    // poll this (one integer compare) to learn whether anything changed
+    // instead of re-fetching the whole CityStats struct every frame.
+    uint64_t GetStatsGeneration() const { return statsGeneration; }
+
     // Internal - not exposed to Python
     void UpdateCityReference();
 
+    // Drops the city and all cached simulator pointers; called on city
+    // shutdown so no getter can touch a dead interface
+    void ClearCityReference();
+
+    // Called by the DllDirector when a simulation message signals that
+    // cached city state may be out of date
+    void InvalidateStatsCache();
+
 private:
     cISC4City* city; // Raw pointer - managed by SC4, we don't own it
+
+    // Simulator interfaces acquired once per city in UpdateCityReference()
+    // instead of a virtual COM fetch per call. Owned by SC4; valid only
+    // while city is, and cleared together in ClearCityReference().
+    cISC4BudgetSimulator* budgetSim;
+    cISC4ResidentialSimulator* residentialSim;
+    cISC4PowerSimulator* powerSim;
+    cISC4PlumbingSimulator* plumbingSim;
+    cISC424HourClock* clock24;
+
     mutable CityStats cachedStats{};
     mutable bool statsCacheValid;
-    
-    void InvalidateStatsCache();
+    mutable uint64_t statsGeneration = 0;
+    mutable GridBuffer gridBuffers[static_cast<size_t>(GridLayer::Count)];
+    mutable bool gridBuffersValid;
+
+    // Recorder ring: preallocated at ConfigureRecorder() so sampling never
+    // allocates. sampleHead is the next write slot; once full, new rows
+    // overwrite the oldest.
+    std::vector<StatsSample> sampleRing;
+    size_t sampleHead;
+    size_t sampleCount;
+    uint32_t sampleInterval;  // Record every Nth RecordTick()
+    uint32_t tickCounter;
+
+    // Snapshot pair: snapshotBack indexes the buffer the next publish
+    // writes; publishedSnapshot always points at the other, completed one.
+    // A buffer's mutex is held for every write to and read from it, so a
+    // reader that resolved a pointer just before a flip either copies the
+    // completed content or waits out the in-progress rewrite - it never
+    // observes the string/vector members mid-reassignment.
+    Snapshot snapshotPair[2];
+    mutable std::mutex snapshotLocks[2];
+    std::atomic<const Snapshot*> publishedSnapshot{nullptr};
+    size_t snapshotBack = 0;
+    uint64_t snapshotGeneration = 0;
+
     void UpdateStatsCache() const;
+    void UpdateGridBuffers() const;
 };
\ No newline at end of file
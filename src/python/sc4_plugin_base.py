@@ -11,6 +11,63 @@ from sc4_types import CheatCommand, SC4Message, CityInfo, CityStats, PluginRespo
 from sc4_logger import get_logger
 
 
+class PluginStateProxy:
+    """
+    Dict-like view over the framework's per-city persistent store.
+
+    Values (bytes, str, int, float) live in native memory and are flushed
+    to disk in the background by the framework, so reads and writes here
+    never touch the filesystem from Python and state survives a crash up
+    to the flush interval. Keys are namespaced per plugin, so two plugins
+    can use the same key without colliding.
+
+    The store follows the city: it opens at city init and syncs at city
+    shutdown. Access outside a city is a silent no-op (gets return the
+    default).
+    """
+
+    _MISSING = object()
+
+    def __init__(self, prefix: str):
+        self._prefix = prefix + "."
+
+    def _full_key(self, key: str) -> str:
+        return self._prefix + key
+
+    def get(self, key: str, default=None):
+        import sc4_native
+        return sc4_native.state_get(self._full_key(key), default)
+
+    def keys(self) -> List[str]:
+        import sc4_native
+        return [k[len(self._prefix):] for k in sc4_native.state_keys()
+                if k.startswith(self._prefix)]
+
+    def __getitem__(self, key: str):
+        value = self.get(key, self._MISSING)
+        if value is self._MISSING:
+            raise KeyError(key)
+        return value
+
+    def __setitem__(self, key: str, value) -> None:
+        import sc4_native
+        sc4_native.state_put(self._full_key(key), value)
+
+    def __delitem__(self, key: str) -> None:
+        import sc4_native
+        if not sc4_native.state_delete(self._full_key(key)):
+            raise KeyError(key)
+
+    def __contains__(self, key: str) -> bool:
+        return self.get(key, self._MISSING) is not self._MISSING
+
+    def __iter__(self):
+        return iter(self.keys())
+
+    def __len__(self) -> int:
+        return len(self.keys())
+
+
 class SC4PluginBase(ABC):
     """
     Base class for all SC4 Python plugins.
@@ -30,6 +87,21 @@ class SC4PluginBase(ABC):
         self.plugin_name = self.__class__.__name__
         self._initialized = False
         self.logger = get_logger(self.plugin_name)
+        self._state: Optional[PluginStateProxy] = None
+
+    @property
+    def state(self) -> PluginStateProxy:
+        """
+        Per-city persistent key-value state for this plugin.
+
+        A dict-like object storing bytes, str, int and float values that
+        persist across sessions without writing JSON from Python: the
+        framework keeps entries in native memory and flushes them to disk
+        in the background. Keys are namespaced by plugin name.
+        """
+        if self._state is None:
+            self._state = PluginStateProxy(self.plugin_name)
+        return self._state
 
     @abstractmethod
     def get_plugin_info(self) -> Dict[str, str]:
@@ -57,13 +129,94 @@ class SC4PluginBase(ABC):
         """
         self._initialized = False
 
+    def get_subscribed_messages(self) -> List[int]:
+        """
+        Declare the message types this plugin wants to receive.
+
+        The framework only dispatches messages whose type appears in this
+        list, so keeping it minimal avoids paying dispatch cost for
+        messages the plugin would ignore anyway. Called once after
+        initialize(), so handlers registered during initialization are
+        picked up.
+
+        Returns:
+            List of message type IDs this plugin handles
+        """
+        return [MessageType.CITY_INIT, MessageType.CITY_SHUTDOWN]
+
+    def get_deferrable_messages(self) -> List[int]:
+        """
+        Declare message types whose handle_message call may run on the
+        framework's worker thread instead of the game thread.
+
+        Deferring is appropriate for analytics-style handlers that only
+        read city state and do not need to finish within the frame. The
+        handler runs with the GIL held but concurrently with the game
+        simulation, so it must not assume it runs before the next message
+        arrives.
+
+        Returns:
+            List of message type IDs that may be handled off-thread
+        """
+        return []
+
+    def get_frame_budget_us(self) -> int:
+        """
+        Declare the per-call time budget for this plugin's message
+        handlers, in microseconds.
+
+        A handler call that runs longer counts as an overrun; after a few
+        consecutive overruns the framework temporarily skips the plugin's
+        inline handler calls so one slow handler cannot keep stalling the
+        frame. Overrun counts show up in the "pystats" cheat dump and
+        sc4_native.get_plugin_stats().
+
+        Returns:
+            Budget in microseconds; 0 disables enforcement for this plugin
+        """
+        return 2000
+
+    def schedule(self, coro):
+        """
+        Schedule a coroutine on the framework's event loop.
+
+        The loop is pumped once per simulation cycle with a hard time
+        budget, so staged work (periodic scans, multi-step automation)
+        written as awaitables progresses a slice at a time without
+        stalling the frame. Use asyncio.sleep(0) between steps to yield.
+
+        Args:
+            coro: The coroutine to run
+
+        Returns:
+            The asyncio.Task wrapping the coroutine
+
+        Raises:
+            RuntimeError: If the framework's event loop is not available
+        """
+        # asyncio.get_event_loop() is thread-local and the framework's
+        # loop belongs to the init thread; resolve it natively so
+        # scheduling works from the game thread (the common case) and the
+        # task lands on the loop the framework actually pumps
+        import sc4_native
+        loop = sc4_native.get_event_loop()
+        if loop is None:
+            raise RuntimeError("The framework event loop is not available")
+        return loop.create_task(coro)
+
     def handle_message(self, message: SC4Message) -> bool:
         """
         Handle an SC4 game message.
-        
+
+        May also be defined as a coroutine (async def): the framework then
+        schedules it on its event loop, which is pumped on idle frames
+        with a hard per-frame time budget. Long jobs written as awaitables
+        amortize across frames instead of spiking one, and coroutine
+        handlers are never charged frame-budget overruns.
+
         Args:
             message: The SC4Message object containing message data
-            
+
         Returns:
             True if the message was handled, False otherwise
         """
@@ -157,17 +310,33 @@ class CheatPlugin(SC4PluginBase):
         super().__init__(city_wrapper)
         self._registered_cheats: Dict[str, str] = {}
 
-    def register_cheat(self, cheat_text: str, description: str) -> None:
+    def register_cheat(self, cheat_text: str, description: str, handler=None) -> None:
         """
         Register a cheat command that this plugin handles.
-        
+
+        When a handler callable is given, the cheat is pushed to the
+        framework's native registry immediately and dispatched straight to
+        the handler - the framework never iterates plugins or calls
+        handle_cheat() for it. Without a handler, the cheat is picked up
+        through the legacy get_registered_cheats() polling pass and routed
+        to handle_cheat() / process_cheat().
+
         Args:
             cheat_text: The cheat text (e.g., "myplugin:givemoney")
             description: Human-readable description of what the cheat does
+            handler: Optional callable invoked as handler(cheat_id, text)
+                     returning True when the cheat was handled
         """
         # Always store cheats in lowercase for consistent case-insensitive handling
         self._registered_cheats[cheat_text.lower()] = description
 
+        if handler is not None:
+            try:
+                import sc4_native
+                sc4_native.register_cheat(cheat_text.lower(), description, handler)
+            except Exception as e:
+                self.logger.error(f"Failed to push cheat registration '{cheat_text}': {e}")
+
     def get_registered_cheats(self) -> Dict[str, str]:
         """
         Get all cheats registered by this plugin.
@@ -225,6 +394,18 @@ class SC4MessagePlugin(SC4PluginBase, ABC):
         """
         self._message_handlers[message_type] = handler_method
 
+    def get_subscribed_messages(self) -> List[int]:
+        """
+        Subscribe to the standard city messages plus every message type
+        that has a registered custom handler.
+
+        Returns:
+            List of message type IDs this plugin handles
+        """
+        subscribed = set(super().get_subscribed_messages())
+        subscribed.update(self._message_handlers.keys())
+        return list(subscribed)
+
     def handle_message(self, message: SC4Message) -> bool:
         """
         Handle an SC4 game message using registered handlers.
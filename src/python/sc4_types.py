@@ -9,6 +9,7 @@ and excellent IDE support.
 from pydantic import BaseModel, Field, computed_field
 from typing import Optional, Dict, Any
 from enum import IntEnum
+import sys
 
 
 class MessageType(IntEnum):
@@ -90,6 +91,84 @@ class CheatCommand(BaseModel):
         frozen = True
 
 
+class _FrozenModelPool:
+    """
+    Fixed ring of pre-constructed model instances for the dispatch hot path.
+
+    Constructing a pydantic model runs field validation on every message and
+    cheat the framework forwards. Since SC4Message/CheatCommand payloads come
+    from trusted native code, the pool instead recycles validated instances
+    and rewrites their fields in place (via object.__setattr__, the same
+    escape hatch frozen models use in model_post_init).
+
+    A recycled instance is only handed out when its refcount shows the
+    previous dispatch dropped every reference; plugins that retain a message
+    beyond the handler call simply cause a fresh allocation next time round,
+    so correctness never depends on the pool.
+    """
+
+    def __init__(self, factory, size=32):
+        self._factory = factory
+        self._ring = [factory() for _ in range(size)]
+        self._index = 0
+
+    def acquire(self, fields):
+        candidate = self._ring[self._index]
+        slot = self._index
+        # The index advances on both paths: a retained instance must not
+        # pin the ring position, or every later acquire would re-check the
+        # same slot and the pool would permanently degrade to allocation.
+        self._index = (self._index + 1) % len(self._ring)
+
+        # References: the ring slot, our local, and getrefcount's argument.
+        # Anything above three means a plugin still holds the instance.
+        if sys.getrefcount(candidate) <= 3:
+            for name, value in fields.items():
+                object.__setattr__(candidate, name, value)
+            return candidate
+
+        # The retained instance leaves the ring to its holder; the fresh
+        # replacement takes over the slot and is recyclable next round
+        replacement = self._factory(**fields)
+        self._ring[slot] = replacement
+        return replacement
+
+
+_message_pool = _FrozenModelPool(
+    lambda **fields: SC4Message(**fields) if fields else SC4Message(message_type=0))
+_cheat_pool = _FrozenModelPool(
+    lambda **fields: CheatCommand(**fields) if fields else CheatCommand(cheat_id=0, text=""))
+
+
+def acquire_message(message_type: int, data1: int = 0, data2: int = 0,
+                    data3: int = 0) -> SC4Message:
+    """
+    Get an SC4Message for dispatch, reusing a pooled instance when possible.
+
+    Called by the C++ framework on every forwarded message. Handlers that
+    need to keep the message beyond the handler call may do so freely; the
+    pool detects the retained reference and leaves that instance alone.
+    """
+    return _message_pool.acquire({
+        'message_type': message_type,
+        'data1': data1,
+        'data2': data2,
+        'data3': data3,
+        'metadata': None,
+    })
+
+
+def acquire_cheat(cheat_id: int, text: str) -> CheatCommand:
+    """
+    Get a CheatCommand for dispatch, reusing a pooled instance when possible.
+    """
+    return _cheat_pool.acquire({
+        'cheat_id': cheat_id,
+        'text': text,
+        'arguments': None,
+    })
+
+
 class CityStats(BaseModel):
     """
     City statistics snapshot with validation.
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Offline decoder for the SC4 Python Framework binary trace log (.blog).
+
+The in-game sink defers all formatting: a record is a static
+format-string ID plus raw argument values (see src/cpp/utils/BinaryLog.h
+for the layout). This tool replays the format table embedded in the file
+and prints the trace as human-readable lines with absolute timestamps.
+
+Usage:
+    python tools/decode_binary_log.py "%USERPROFILE%/Documents/SimCity 4/SC4PythonFramework.blog"
+
+Notes:
+- Decoding is two-pass: format-definition records land in the buffer of
+  the thread that registered them, so with multiple threads a definition
+  can reach the file after an event that references its ID.
+- The header carries the QPC frequency and a wall-clock anchor taken at
+  initialization; event ticks are mapped to absolute time by treating
+  the earliest tick in the file as that anchor.
+- A truncated trailing record is normal (per-thread buffers flush on
+  their own cadence and the game may exit mid-buffer); decoding stops
+  there with a note.
+"""
+
+import argparse
+import struct
+import sys
+from datetime import datetime
+
+MAGIC = b"S4BL"
+SUPPORTED_VERSION = 1
+HEADER_SIZE = 4 + 4 + 8 + 8
+
+KIND_EVENT = 1
+KIND_FORMAT = 2
+
+TAG_U64 = 0
+TAG_STR = 1
+
+
+class Truncated(Exception):
+    """Raised when a record extends past the end of the file."""
+
+
+class Reader:
+    """Forward-only cursor over the file bytes."""
+
+    def __init__(self, data, offset=0):
+        self.data = data
+        self.offset = offset
+
+    def at_end(self):
+        return self.offset >= len(self.data)
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.offset + size > len(self.data):
+            raise Truncated()
+        value = struct.unpack_from(fmt, self.data, self.offset)[0]
+        self.offset += size
+        return value
+
+    def take_bytes(self, count):
+        if self.offset + count > len(self.data):
+            raise Truncated()
+        chunk = self.data[self.offset:self.offset + count]
+        self.offset += count
+        return chunk
+
+
+def read_header(reader):
+    if reader.take_bytes(4) != MAGIC:
+        sys.exit("Not a binary trace log (bad magic)")
+    version = reader.take("<I")
+    if version != SUPPORTED_VERSION:
+        sys.exit(f"Unsupported log version {version} (decoder supports {SUPPORTED_VERSION})")
+    frequency = reader.take("<Q")
+    epoch_ms = reader.take("<Q")
+    return frequency, epoch_ms
+
+
+def read_record(reader):
+    """Returns (kind, payload) or raises Truncated at a partial record."""
+    kind = reader.take("<B")
+    if kind == KIND_FORMAT:
+        format_id = reader.take("<H")
+        length = reader.take("<H")
+        text = reader.take_bytes(length).decode("utf-8", errors="replace")
+        return kind, (format_id, text)
+    if kind == KIND_EVENT:
+        format_id = reader.take("<H")
+        ticks = reader.take("<Q")
+        argc = reader.take("<B")
+        args = []
+        for _ in range(argc):
+            tag = reader.take("<B")
+            if tag == TAG_U64:
+                args.append(reader.take("<Q"))
+            elif tag == TAG_STR:
+                length = reader.take("<B")
+                args.append(reader.take_bytes(length).decode("utf-8", errors="replace"))
+            else:
+                raise Truncated()  # Unknown tag: treat the rest as unreadable
+        return kind, (format_id, ticks, args)
+    raise Truncated()  # Unknown kind: cannot know its length
+
+
+def decode(path):
+    with open(path, "rb") as handle:
+        data = handle.read()
+
+    reader = Reader(data)
+    frequency, epoch_ms = read_header(reader)
+
+    # Pass 1: collect the format table and the earliest tick
+    formats = {}
+    first_tick = None
+    scan = Reader(data, reader.offset)
+    while not scan.at_end():
+        try:
+            kind, payload = read_record(scan)
+        except Truncated:
+            break
+        if kind == KIND_FORMAT:
+            format_id, text = payload
+            formats[format_id] = text
+        else:
+            _, ticks, _ = payload
+            if first_tick is None or ticks < first_tick:
+                first_tick = ticks
+
+    # Pass 2: print events in file order
+    events = 0
+    while not reader.at_end():
+        try:
+            kind, payload = read_record(reader)
+        except Truncated:
+            print("-- truncated record at end of file (partial buffer flush) --",
+                  file=sys.stderr)
+            break
+        if kind != KIND_EVENT:
+            continue
+
+        format_id, ticks, args = payload
+        seconds = epoch_ms / 1000.0 + (ticks - first_tick) / frequency
+        stamp = datetime.fromtimestamp(seconds).strftime("%Y-%m-%d %H:%M:%S.%f")[:-3]
+
+        text = formats.get(format_id)
+        if text is None:
+            line = f"<unknown format #{format_id}> args={args}"
+        else:
+            try:
+                line = text.format(*args)
+            except (IndexError, KeyError, ValueError):
+                line = f"{text} <args: {args}>"
+        print(f"[{stamp}] {line}")
+        events += 1
+
+    print(f"-- {events} events, {len(formats)} format strings --", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode an SC4PythonFramework.blog binary trace log")
+    parser.add_argument("logfile", help="Path to the .blog file")
+    args = parser.parse_args()
+    decode(args.logfile)
+
+
+if __name__ == "__main__":
+    main()